@@ -0,0 +1,27 @@
+using UnrealBuildTool;
+
+public class MDFastBindingGameplayAbilities : ModuleRules
+{
+	public MDFastBindingGameplayAbilities(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"GameplayAbilities",
+				"GameplayTags",
+				"MDFastBinding"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Engine"
+			}
+		);
+	}
+}
@@ -0,0 +1,108 @@
+#include "BindingValues/MDFastBindingValue_AbilitySystemBase.h"
+
+#include "AbilitySystemComponent.h"
+#include "MDFastBindingGameplayAbilitiesHelpers.h"
+#include "GameFramework/Pawn.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingValue_AbilitySystemBase"
+
+namespace MDFastBindingValue_AbilitySystemBase_Private
+{
+	const FName TargetName = TEXT("Target");
+}
+
+UMDFastBindingValue_AbilitySystemBase::UMDFastBindingValue_AbilitySystemBase()
+{
+	UpdateType = EMDFastBindingUpdateType::EventBased;
+}
+
+bool UMDFastBindingValue_AbilitySystemBase::CheckNeedsUpdate() const
+{
+	// A destroyed component won't send us any more events
+	return AbilitySystemComponent.IsStale() || Super::CheckNeedsUpdate();
+}
+
+void UMDFastBindingValue_AbilitySystemBase::InitializeValue_Internal(UObject* SourceObject)
+{
+	Super::InitializeValue_Internal(SourceObject);
+
+	UpdateAbilitySystemComponent(SourceObject);
+}
+
+void UMDFastBindingValue_AbilitySystemBase::TerminateValue_Internal(UObject* SourceObject)
+{
+	Super::TerminateValue_Internal(SourceObject);
+
+	SetAbilitySystemComponent(nullptr);
+	WatchTargetPawn(nullptr);
+	TargetObject.Reset();
+}
+
+void UMDFastBindingValue_AbilitySystemBase::SetupBindingItems()
+{
+	Super::SetupBindingItems();
+
+	EnsureBindingItemExists(MDFastBindingValue_AbilitySystemBase_Private::TargetName
+		, GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_AbilitySystemBase, Target))
+		, GetTargetToolTip());
+}
+
+FText UMDFastBindingValue_AbilitySystemBase::GetTargetToolTip() const
+{
+	return LOCTEXT("TargetToolTip", "An ability system component, or an actor that has one");
+}
+
+UAbilitySystemComponent* UMDFastBindingValue_AbilitySystemBase::UpdateAbilitySystemComponent(UObject* SourceObject)
+{
+	bool bDidUpdate = false;
+	const TTuple<const FProperty*, void*> TargetValue = GetBindingItemValue(SourceObject, MDFastBindingValue_AbilitySystemBase_Private::TargetName, bDidUpdate);
+	UObject* NewTarget = (CastField<const FObjectPropertyBase>(TargetValue.Key) != nullptr && TargetValue.Value != nullptr)
+		? *static_cast<UObject**>(TargetValue.Value)
+		: nullptr;
+
+	if (NewTarget != TargetObject.Get())
+	{
+		TargetObject = NewTarget;
+		WatchTargetPawn(Cast<APawn>(NewTarget));
+	}
+
+	UAbilitySystemComponent* NewComponent = FMDFastBindingGameplayAbilitiesHelpers::FindAbilitySystemComponent(NewTarget);
+	if (NewComponent != AbilitySystemComponent.Get() || AbilitySystemComponent.IsStale())
+	{
+		SetAbilitySystemComponent(NewComponent);
+	}
+
+	return NewComponent;
+}
+
+void UMDFastBindingValue_AbilitySystemBase::SetAbilitySystemComponent(UAbilitySystemComponent* NewComponent)
+{
+	// Old will be null if it has been destroyed, subclasses still need to forget about it
+	UAbilitySystemComponent* OldComponent = AbilitySystemComponent.Get();
+	AbilitySystemComponent = NewComponent;
+
+	OnAbilitySystemComponentChanged(OldComponent, NewComponent);
+}
+
+void UMDFastBindingValue_AbilitySystemBase::WatchTargetPawn(APawn* Pawn)
+{
+	if (APawn* OldPawn = WatchedPawn.Get())
+	{
+		OldPawn->ReceiveControllerChangedDelegate.RemoveDynamic(this, &UMDFastBindingValue_AbilitySystemBase::OnTargetControllerChanged);
+	}
+
+	WatchedPawn = Pawn;
+
+	if (Pawn != nullptr)
+	{
+		Pawn->ReceiveControllerChangedDelegate.AddUniqueDynamic(this, &UMDFastBindingValue_AbilitySystemBase::OnTargetControllerChanged);
+	}
+}
+
+void UMDFastBindingValue_AbilitySystemBase::OnTargetControllerChanged(APawn* Pawn, AController* OldController, AController* NewController)
+{
+	// The pawn's component may now come from a different player state, UpdateAbilitySystemComponent will pick it up
+	MarkObjectDirty();
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,74 @@
+#include "BindingValues/MDFastBindingValue_GameplayAttribute.h"
+
+#include "AbilitySystemComponent.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingValue_GameplayAttribute"
+
+const FProperty* UMDFastBindingValue_GameplayAttribute::GetOutputProperty()
+{
+	return GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_GameplayAttribute, AttributeValue));
+}
+
+#if WITH_EDITORONLY_DATA
+FText UMDFastBindingValue_GameplayAttribute::GetDisplayName()
+{
+	if (Attribute.IsValid())
+	{
+		return FText::FromString(Attribute.GetName());
+	}
+
+	return Super::GetDisplayName();
+}
+#endif
+
+#if WITH_EDITOR
+EDataValidationResult UMDFastBindingValue_GameplayAttribute::IsDataValid(TArray<FText>& ValidationErrors)
+{
+	EDataValidationResult Result = Super::IsDataValid(ValidationErrors);
+
+	if (!Attribute.IsValid())
+	{
+		Result = EDataValidationResult::Invalid;
+		ValidationErrors.Add(LOCTEXT("InvalidAttributeError", "An attribute must be selected"));
+	}
+
+	return Result;
+}
+#endif
+
+TTuple<const FProperty*, void*> UMDFastBindingValue_GameplayAttribute::GetValue_Internal(UObject* SourceObject)
+{
+	// Rebinds our delegate if the target or its ability system component has changed
+	UAbilitySystemComponent* AbilitySystemComponent = UpdateAbilitySystemComponent(SourceObject);
+
+	// Failing to get a value leaves us without a cached value, so we keep checking until the attribute set has been added
+	if (AbilitySystemComponent == nullptr || !Attribute.IsValid() || !AbilitySystemComponent->HasAttributeSetForAttribute(Attribute))
+	{
+		return TTuple<const FProperty*, void*>{ GetOutputProperty(), nullptr };
+	}
+
+	AttributeValue = AbilitySystemComponent->GetNumericAttribute(Attribute);
+	return TTuple<const FProperty*, void*>{ GetOutputProperty(), &AttributeValue };
+}
+
+void UMDFastBindingValue_GameplayAttribute::OnAbilitySystemComponentChanged(UAbilitySystemComponent* OldComponent, UAbilitySystemComponent* NewComponent)
+{
+	if (OldComponent != nullptr)
+	{
+		OldComponent->GetGameplayAttributeValueChangeDelegate(Attribute).Remove(AttributeChangedHandle);
+	}
+
+	AttributeChangedHandle.Reset();
+
+	if (NewComponent != nullptr && Attribute.IsValid())
+	{
+		AttributeChangedHandle = NewComponent->GetGameplayAttributeValueChangeDelegate(Attribute).AddUObject(this, &UMDFastBindingValue_GameplayAttribute::OnAttributeChanged);
+	}
+}
+
+void UMDFastBindingValue_GameplayAttribute::OnAttributeChanged(const FOnAttributeChangeData& ChangeData)
+{
+	MarkObjectDirty();
+}
+
+#undef LOCTEXT_NAMESPACE
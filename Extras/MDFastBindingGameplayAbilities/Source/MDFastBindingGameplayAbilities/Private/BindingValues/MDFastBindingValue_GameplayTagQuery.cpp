@@ -0,0 +1,110 @@
+#include "BindingValues/MDFastBindingValue_GameplayTagQuery.h"
+
+#include "AbilitySystemComponent.h"
+#include "GameplayTagAssetInterface.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingValue_GameplayTagQuery"
+
+const FProperty* UMDFastBindingValue_GameplayTagQuery::GetOutputProperty()
+{
+	return GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_GameplayTagQuery, bMatchesQuery));
+}
+
+#if WITH_EDITORONLY_DATA
+FText UMDFastBindingValue_GameplayTagQuery::GetDisplayName()
+{
+	if (!TagQuery.IsEmpty())
+	{
+		return FText::FromString(TagQuery.GetDescription());
+	}
+
+	return Super::GetDisplayName();
+}
+#endif
+
+#if WITH_EDITOR
+EDataValidationResult UMDFastBindingValue_GameplayTagQuery::IsDataValid(TArray<FText>& ValidationErrors)
+{
+	EDataValidationResult Result = Super::IsDataValid(ValidationErrors);
+
+	if (TagQuery.IsEmpty())
+	{
+		Result = EDataValidationResult::Invalid;
+		ValidationErrors.Add(LOCTEXT("EmptyQueryError", "The tag query is empty and will never match"));
+	}
+
+	return Result;
+}
+#endif
+
+bool UMDFastBindingValue_GameplayTagQuery::CheckNeedsUpdate() const
+{
+	return bIsPollingTarget || Super::CheckNeedsUpdate();
+}
+
+TTuple<const FProperty*, void*> UMDFastBindingValue_GameplayTagQuery::GetValue_Internal(UObject* SourceObject)
+{
+	// Rebinds our tag events if the target or its ability system component has changed
+	UAbilitySystemComponent* AbilitySystemComponent = UpdateAbilitySystemComponent(SourceObject);
+
+	const IGameplayTagAssetInterface* TagInterface = AbilitySystemComponent != nullptr
+		? AbilitySystemComponent
+		: Cast<IGameplayTagAssetInterface>(GetTargetObject());
+	bIsPollingTarget = AbilitySystemComponent == nullptr && TagInterface != nullptr;
+
+	if (TagInterface == nullptr)
+	{
+		return TTuple<const FProperty*, void*>{ GetOutputProperty(), nullptr };
+	}
+
+	FGameplayTagContainer OwnedTags;
+	TagInterface->GetOwnedGameplayTags(OwnedTags);
+	bMatchesQuery = TagQuery.Matches(OwnedTags);
+
+	return TTuple<const FProperty*, void*>{ GetOutputProperty(), &bMatchesQuery };
+}
+
+void UMDFastBindingValue_GameplayTagQuery::TerminateValue_Internal(UObject* SourceObject)
+{
+	Super::TerminateValue_Internal(SourceObject);
+
+	bIsPollingTarget = false;
+}
+
+FText UMDFastBindingValue_GameplayTagQuery::GetTargetToolTip() const
+{
+	return LOCTEXT("TargetToolTip", "An ability system component, an actor that has one, or an object implementing IGameplayTagAssetInterface");
+}
+
+void UMDFastBindingValue_GameplayTagQuery::OnAbilitySystemComponentChanged(UAbilitySystemComponent* OldComponent, UAbilitySystemComponent* NewComponent)
+{
+	if (OldComponent != nullptr)
+	{
+		for (const TPair<FGameplayTag, FDelegateHandle>& TagEventHandle : TagEventHandles)
+		{
+			OldComponent->UnregisterGameplayTagEvent(TagEventHandle.Value, TagEventHandle.Key, EGameplayTagEventType::NewOrRemoved);
+		}
+	}
+
+	TagEventHandles.Reset();
+
+	if (NewComponent == nullptr)
+	{
+		return;
+	}
+
+	// Tag events also fire for parent tags, so registering for the query's tags catches their children being added or removed
+	for (const FGameplayTag& Tag : TagQuery.GetGameplayTagArray())
+	{
+		const FDelegateHandle Handle = NewComponent->RegisterGameplayTagEvent(Tag, EGameplayTagEventType::NewOrRemoved)
+			.AddUObject(this, &UMDFastBindingValue_GameplayTagQuery::OnTagCountChanged);
+		TagEventHandles.Emplace(Tag, Handle);
+	}
+}
+
+void UMDFastBindingValue_GameplayTagQuery::OnTagCountChanged(const FGameplayTag Tag, int32 NewCount)
+{
+	MarkObjectDirty();
+}
+
+#undef LOCTEXT_NAMESPACE
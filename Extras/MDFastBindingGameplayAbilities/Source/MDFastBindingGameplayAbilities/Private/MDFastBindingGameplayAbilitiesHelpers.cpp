@@ -0,0 +1,20 @@
+#include "MDFastBindingGameplayAbilitiesHelpers.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "GameFramework/Actor.h"
+
+UAbilitySystemComponent* FMDFastBindingGameplayAbilitiesHelpers::FindAbilitySystemComponent(UObject* Object)
+{
+	if (UAbilitySystemComponent* AbilitySystemComponent = Cast<UAbilitySystemComponent>(Object))
+	{
+		return AbilitySystemComponent;
+	}
+
+	if (const AActor* Actor = Cast<AActor>(Object))
+	{
+		return UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Actor);
+	}
+
+	return nullptr;
+}
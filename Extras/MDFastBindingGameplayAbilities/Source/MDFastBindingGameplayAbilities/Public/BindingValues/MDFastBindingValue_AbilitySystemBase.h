@@ -0,0 +1,55 @@
+#pragma once
+
+#include "BindingValues/MDFastBindingValueBase.h"
+#include "MDFastBindingValue_AbilitySystemBase.generated.h"
+
+class AController;
+class APawn;
+class UAbilitySystemComponent;
+
+/**
+ * Base class for event based values that read from the ability system component of their Target.
+ * Keeps track of which component the Target resolves to so subclasses can move their delegates when it changes.
+ * A pawn's component is looked up again when its controller changes, which is when components owned by the player state come and go.
+ * Components swapped on an actor without a controller change are only noticed the next time something else updates the node.
+ */
+UCLASS(Abstract)
+class MDFASTBINDINGGAMEPLAYABILITIES_API UMDFastBindingValue_AbilitySystemBase : public UMDFastBindingValueBase
+{
+	GENERATED_BODY()
+
+public:
+	UMDFastBindingValue_AbilitySystemBase();
+
+protected:
+	virtual bool CheckNeedsUpdate() const override;
+
+	virtual void InitializeValue_Internal(UObject* SourceObject) override;
+	virtual void TerminateValue_Internal(UObject* SourceObject) override;
+	virtual void SetupBindingItems() override;
+
+	// Resolves the Target pin and returns its ability system component, calling OnAbilitySystemComponentChanged first if it's not the one we're bound to
+	UAbilitySystemComponent* UpdateAbilitySystemComponent(UObject* SourceObject);
+
+	// Called when the target's ability system component changes, either component can be null
+	virtual void OnAbilitySystemComponentChanged(UAbilitySystemComponent* OldComponent, UAbilitySystemComponent* NewComponent) {}
+
+	virtual FText GetTargetToolTip() const;
+
+	UObject* GetTargetObject() const { return TargetObject.Get(); }
+
+	UPROPERTY(Transient)
+	TObjectPtr<UObject> Target = nullptr;
+
+private:
+	void SetAbilitySystemComponent(UAbilitySystemComponent* NewComponent);
+
+	void WatchTargetPawn(APawn* Pawn);
+
+	UFUNCTION()
+	void OnTargetControllerChanged(APawn* Pawn, AController* OldController, AController* NewController);
+
+	TWeakObjectPtr<UObject> TargetObject;
+	TWeakObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
+	TWeakObjectPtr<APawn> WatchedPawn;
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "AttributeSet.h"
+#include "BindingValues/MDFastBindingValue_AbilitySystemBase.h"
+#include "MDFastBindingValue_GameplayAttribute.generated.h"
+
+struct FOnAttributeChangeData;
+
+/**
+ * Retrieve the current value of a gameplay attribute any time it changes
+ */
+UCLASS(meta = (DisplayName = "Gameplay Attribute"))
+class MDFASTBINDINGGAMEPLAYABILITIES_API UMDFastBindingValue_GameplayAttribute : public UMDFastBindingValue_AbilitySystemBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual const FProperty* GetOutputProperty() override;
+
+#if WITH_EDITORONLY_DATA
+	virtual FText GetDisplayName() override;
+#endif
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+#endif
+
+protected:
+	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+
+	virtual void OnAbilitySystemComponentChanged(UAbilitySystemComponent* OldComponent, UAbilitySystemComponent* NewComponent) override;
+
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	FGameplayAttribute Attribute;
+
+private:
+	void OnAttributeChanged(const FOnAttributeChangeData& ChangeData);
+
+	UPROPERTY(Transient)
+	float AttributeValue = 0.f;
+
+	FDelegateHandle AttributeChangedHandle;
+};
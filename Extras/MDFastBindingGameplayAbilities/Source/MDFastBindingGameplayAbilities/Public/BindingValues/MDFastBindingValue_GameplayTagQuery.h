@@ -0,0 +1,50 @@
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "BindingValues/MDFastBindingValue_AbilitySystemBase.h"
+#include "MDFastBindingValue_GameplayTagQuery.generated.h"
+
+/**
+ * Whether a target's owned gameplay tags match a query.
+ * Ability system components are only checked again when the count of a tag in the query changes,
+ * other targets implementing IGameplayTagAssetInterface are checked every update since they have no change events.
+ */
+UCLASS(meta = (DisplayName = "Gameplay Tag Query"))
+class MDFASTBINDINGGAMEPLAYABILITIES_API UMDFastBindingValue_GameplayTagQuery : public UMDFastBindingValue_AbilitySystemBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual const FProperty* GetOutputProperty() override;
+
+#if WITH_EDITORONLY_DATA
+	virtual FText GetDisplayName() override;
+#endif
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+#endif
+
+protected:
+	virtual bool CheckNeedsUpdate() const override;
+
+	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+	virtual void TerminateValue_Internal(UObject* SourceObject) override;
+
+	virtual void OnAbilitySystemComponentChanged(UAbilitySystemComponent* OldComponent, UAbilitySystemComponent* NewComponent) override;
+
+	virtual FText GetTargetToolTip() const override;
+
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	FGameplayTagQuery TagQuery;
+
+private:
+	void OnTagCountChanged(const FGameplayTag Tag, int32 NewCount);
+
+	UPROPERTY(Transient)
+	bool bMatchesQuery = false;
+
+	TArray<TPair<FGameplayTag, FDelegateHandle>> TagEventHandles;
+
+	// Set while the target has no ability system component to get tag change events from
+	bool bIsPollingTarget = false;
+};
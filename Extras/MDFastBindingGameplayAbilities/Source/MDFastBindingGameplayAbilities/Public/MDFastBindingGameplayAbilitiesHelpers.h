@@ -0,0 +1,11 @@
+#pragma once
+
+class UAbilitySystemComponent;
+class UObject;
+
+class MDFASTBINDINGGAMEPLAYABILITIES_API FMDFastBindingGameplayAbilitiesHelpers
+{
+public:
+	// Accepts an ability system component or an actor that has one, either directly or through IAbilitySystemInterface
+	static UAbilitySystemComponent* FindAbilitySystemComponent(UObject* Object);
+};
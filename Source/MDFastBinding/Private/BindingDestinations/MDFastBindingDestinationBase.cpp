@@ -1,7 +1,9 @@
 ﻿#include "BindingDestinations/MDFastBindingDestinationBase.h"
 
+#include "MDFastBindingContainer.h"
 #include "MDFastBindingInstance.h"
 #include "BindingValues/MDFastBindingValueBase.h"
+#include "Util/MDFastBindingScheduler.h"
 
 void UMDFastBindingDestinationBase::InitializeDestination(UObject* SourceObject)
 {
@@ -25,15 +27,28 @@ void UMDFastBindingDestinationBase::UpdateDestination(UObject* SourceObject)
 	if (CheckCachedNeedsUpdate())
 	{
 		UpdateDestination_Internal(SourceObject);
+		MarkObjectClean();
 	}
 }
 
+void UMDFastBindingDestinationBase::CommitDestination()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*GetName());
+	CommitDestination_Internal();
+}
+
 void UMDFastBindingDestinationBase::TerminateDestination(UObject* SourceObject)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
 	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*GetName());
 	TerminateDestination_Internal(SourceObject);
 
+	if (UpdateType == EMDFastBindingUpdateType::Interval)
+	{
+		FMDFastBindingScheduler::Get().CancelWakeUp(this);
+	}
+
 	for (const FMDFastBindingItem& BindingItem : BindingItems)
 	{
 		if (BindingItem.Value != nullptr)
@@ -48,6 +63,38 @@ bool UMDFastBindingDestinationBase::CheckNeedsUpdate() const
 	return !bHasEverUpdated || Super::CheckNeedsUpdate();
 }
 
+bool UMDFastBindingDestinationBase::ShouldDeferCommit() const
+{
+	const UMDFastBindingContainer* Container = GetOuterContainer();
+	return Container != nullptr && Container->IsDeferringDestinationWrites();
+}
+
+void UMDFastBindingDestinationBase::QueueCommit(UObject* TargetObject)
+{
+	if (UMDFastBindingContainer* Container = GetOuterContainer())
+	{
+		Container->QueueDestinationCommit(this, TargetObject);
+	}
+}
+
+UMDFastBindingContainer* UMDFastBindingDestinationBase::GetOuterContainer() const
+{
+#if !WITH_EDITOR
+	if (OuterContainer.IsValid())
+	{
+		return OuterContainer.Get();
+	}
+#endif
+
+	if (const UMDFastBindingInstance* Binding = GetOuterBinding())
+	{
+		OuterContainer = Binding->GetBindingContainer();
+		return OuterContainer.Get();
+	}
+
+	return nullptr;
+}
+
 void UMDFastBindingDestinationBase::MarkAsHasEverUpdated()
 {
 	bHasEverUpdated = true;
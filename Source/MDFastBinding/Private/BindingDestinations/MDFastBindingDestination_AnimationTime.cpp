@@ -0,0 +1,121 @@
+#include "BindingDestinations/MDFastBindingDestination_AnimationTime.h"
+
+#include "MDFastBinding.h"
+#include "Animation/UMGSequencePlayer.h"
+#include "Animation/WidgetAnimation.h"
+#include "Blueprint/UserWidget.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingDestination_AnimationTime"
+
+namespace MDFastBindingDestination_AnimationTime_Private
+{
+	const FName WidgetName = TEXT("Widget");
+	const FName AnimationName = TEXT("Animation");
+	const FName TimeName = TEXT("Time");
+}
+
+void UMDFastBindingDestination_AnimationTime::UpdateDestination_Internal(UObject* SourceObject)
+{
+	bool bDidWidgetUpdate = false;
+	const TTuple<const FProperty*, void*> WidgetValue = GetBindingItemValue(SourceObject, MDFastBindingDestination_AnimationTime_Private::WidgetName, bDidWidgetUpdate);
+	TargetWidget = WidgetValue.Value != nullptr ? Cast<UUserWidget>(*static_cast<UObject**>(WidgetValue.Value)) : nullptr;
+
+	bool bDidAnimationUpdate = false;
+	const TTuple<const FProperty*, void*> AnimationValue = GetBindingItemValue(SourceObject, MDFastBindingDestination_AnimationTime_Private::AnimationName, bDidAnimationUpdate);
+	TargetAnimation = AnimationValue.Value != nullptr ? Cast<UWidgetAnimation>(*static_cast<UObject**>(AnimationValue.Value)) : nullptr;
+
+	bool bDidTimeUpdate = false;
+	const TTuple<const FProperty*, void*> TimeValue = GetBindingItemValue(SourceObject, MDFastBindingDestination_AnimationTime_Private::TimeName, bDidTimeUpdate);
+	if (TimeValue.Key == nullptr || TimeValue.Value == nullptr || !TargetWidget.IsValid() || !TargetAnimation.IsValid())
+	{
+		return;
+	}
+
+	if (UpdateType != EMDFastBindingUpdateType::IfUpdatesNeeded || bDidWidgetUpdate || bDidAnimationUpdate || bDidTimeUpdate || !HasEverUpdated())
+	{
+		const FProperty* TimeProp = GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingDestination_AnimationTime, TimeProperty));
+		FMDFastBindingModule::SetPropertyDirectly(TimeProp, &PendingTime, TimeValue.Key, TimeValue.Value);
+
+		if (ShouldDeferCommit())
+		{
+			QueueCommit(TargetWidget.Get());
+		}
+		else
+		{
+			ApplyPendingTime();
+		}
+	}
+}
+
+void UMDFastBindingDestination_AnimationTime::CommitDestination_Internal()
+{
+	ApplyPendingTime();
+}
+
+void UMDFastBindingDestination_AnimationTime::ApplyPendingTime()
+{
+	UUserWidget* Widget = TargetWidget.Get();
+	UWidgetAnimation* Animation = TargetAnimation.Get();
+	if (Widget == nullptr || Animation == nullptr)
+	{
+		return;
+	}
+
+	// Our player is no longer usable if the widget stopped or recycled it (eg. StopAllAnimations), setting its time would evaluate nothing
+	UUMGSequencePlayer* Player = SequencePlayer.Get();
+	const bool bHasPlayer = Player != nullptr && AppliedWidget.Get() == Widget && Widget->GetSequencePlayer(Animation) == Player;
+	if (HasEverUpdated() && bHasPlayer && AppliedTime == PendingTime)
+	{
+		return;
+	}
+
+	const float StartTime = Animation->GetStartTime();
+	const float EndTime = Animation->GetEndTime();
+	const float Time = bUseNormalizedTime
+		? FMath::Lerp(StartTime, EndTime, FMath::Clamp(PendingTime, 0.f, 1.f))
+		: FMath::Clamp(PendingTime, StartTime, EndTime);
+
+	if (!bHasPlayer)
+	{
+		// Only acquiring the player plays the animation, after that it stays paused so it doesn't tick or fire started/finished events
+		Player = Widget->PlayAnimation(Animation, Time, 1, EUMGSequencePlayMode::Forward, 1.f, false);
+		SequencePlayer = Player;
+		AppliedWidget = Widget;
+	}
+
+	if (Player != nullptr)
+	{
+		// Pausing evaluates the sequence at the current time without finishing the animation
+		Player->SetCurrentTime(Time);
+		Player->Pause();
+	}
+
+	AppliedTime = PendingTime;
+
+	MarkAsHasEverUpdated();
+}
+
+void UMDFastBindingDestination_AnimationTime::SetupBindingItems()
+{
+	Super::SetupBindingItems();
+
+	EnsureBindingItemExists(MDFastBindingDestination_AnimationTime_Private::WidgetName
+		, GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingDestination_AnimationTime, WidgetProperty))
+		, LOCTEXT("WidgetToolTip", "The widget that plays the animation. (Defaults to 'Self').")
+		, true);
+	EnsureBindingItemExists(MDFastBindingDestination_AnimationTime_Private::AnimationName
+		, GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingDestination_AnimationTime, AnimationProperty))
+		, LOCTEXT("AnimationToolTip", "The animation to set the playback position of"));
+	EnsureBindingItemExists(MDFastBindingDestination_AnimationTime_Private::TimeName
+		, GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingDestination_AnimationTime, TimeProperty))
+		, LOCTEXT("TimeToolTip", "The playback position in seconds, or 0-1 across the animation if using normalized time"));
+}
+
+#if WITH_EDITORONLY_DATA
+bool UMDFastBindingDestination_AnimationTime::DoesBindingItemDefaultToSelf(const FName& InItemName) const
+{
+	return InItemName == MDFastBindingDestination_AnimationTime_Private::WidgetName;
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
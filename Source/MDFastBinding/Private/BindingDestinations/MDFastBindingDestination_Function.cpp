@@ -13,6 +13,8 @@ void UMDFastBindingDestination_Function::InitializeDestination_Internal(UObject*
 {
 	Super::InitializeDestination_Internal(SourceObject);
 
+	// Always means the function must be called every update, even with the same arguments
+	Function.bSkipCallIfParamsUnchanged = bSkipCallIfArgumentsUnchanged && UpdateType != EMDFastBindingUpdateType::Always;
 	Function.BuildFunctionData();
 }
 
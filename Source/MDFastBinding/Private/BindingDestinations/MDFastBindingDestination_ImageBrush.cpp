@@ -0,0 +1,19 @@
+#include "BindingDestinations/MDFastBindingDestination_ImageBrush.h"
+
+#include "Components/Image.h"
+
+TSubclassOf<UWidget> UMDFastBindingDestination_ImageBrush::GetWidgetClass() const
+{
+	return UImage::StaticClass();
+}
+
+FName UMDFastBindingDestination_ImageBrush::GetWidgetPropertyName() const
+{
+	static const FName PropertyName = TEXT("Brush");
+	return PropertyName;
+}
+
+void UMDFastBindingDestination_ImageBrush::ApplyValue(UWidget& Widget, const void* ValuePtr) const
+{
+	static_cast<UImage&>(Widget).SetBrush(*static_cast<const FSlateBrush*>(ValuePtr));
+}
@@ -0,0 +1,19 @@
+#include "BindingDestinations/MDFastBindingDestination_ImageColor.h"
+
+#include "Components/Image.h"
+
+TSubclassOf<UWidget> UMDFastBindingDestination_ImageColor::GetWidgetClass() const
+{
+	return UImage::StaticClass();
+}
+
+FName UMDFastBindingDestination_ImageColor::GetWidgetPropertyName() const
+{
+	static const FName PropertyName = TEXT("ColorAndOpacity");
+	return PropertyName;
+}
+
+void UMDFastBindingDestination_ImageColor::ApplyValue(UWidget& Widget, const void* ValuePtr) const
+{
+	static_cast<UImage&>(Widget).SetColorAndOpacity(*static_cast<const FLinearColor*>(ValuePtr));
+}
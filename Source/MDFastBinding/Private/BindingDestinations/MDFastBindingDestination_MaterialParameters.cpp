@@ -0,0 +1,236 @@
+#include "BindingDestinations/MDFastBindingDestination_MaterialParameters.h"
+
+#include "MDFastBinding.h"
+#include "Components/Image.h"
+#include "Engine/Texture.h"
+#include "Materials/MaterialInstanceDynamic.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingDestination_MaterialParameters"
+
+namespace MDFastBindingDestination_MaterialParameters_Private
+{
+	const FName ImageName = TEXT("Image");
+}
+
+void UMDFastBindingDestination_MaterialParameters::InitializeDestination_Internal(UObject* SourceObject)
+{
+	Super::InitializeDestination_Internal(SourceObject);
+
+	TargetImage.Reset();
+	TargetMaterial.Reset();
+	ResetParameterStates();
+}
+
+void UMDFastBindingDestination_MaterialParameters::UpdateDestination_Internal(UObject* SourceObject)
+{
+	bool bDidImageUpdate = false;
+	const TTuple<const FProperty*, void*> ImageValue = GetBindingItemValue(SourceObject, MDFastBindingDestination_MaterialParameters_Private::ImageName, bDidImageUpdate);
+	UImage* Image = ImageValue.Value != nullptr ? Cast<UImage>(*static_cast<UObject**>(ImageValue.Value)) : nullptr;
+
+	// Grab the dynamic material again if the image changed or something else replaced the material on its brush
+	if (Image == nullptr || Image != TargetImage.Get() || !TargetMaterial.IsValid() || Image->GetBrush().GetResourceObject() != TargetMaterial.Get()
+		|| ParameterStates.Num() != Parameters.Num())
+	{
+		TargetImage = Image;
+		TargetMaterial = Image != nullptr ? Image->GetDynamicMaterial() : nullptr;
+		ResetParameterStates();
+	}
+
+	if (!TargetMaterial.IsValid())
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < Parameters.Num(); ++i)
+	{
+		const FMDFastBindingMaterialParameter& Parameter = Parameters[i];
+		FParameterState& State = ParameterStates[i];
+
+		bool bDidUpdate = false;
+		const TTuple<const FProperty*, void*> Value = GetBindingItemValue(SourceObject, Parameter.ParameterName, bDidUpdate);
+		if (Value.Key == nullptr || Value.Value == nullptr)
+		{
+			continue;
+		}
+
+		if (State.bIsInitialized && !bDidUpdate && UpdateType == EMDFastBindingUpdateType::IfUpdatesNeeded)
+		{
+			continue;
+		}
+
+		const FProperty* ParameterProp = GetParameterTypeProperty(Parameter.ParameterType);
+		bool bHasChanged = !State.bIsInitialized;
+		if (Parameter.ParameterType == EMDFastBindingMaterialParameterType::Scalar)
+		{
+			float NewValue = 0.f;
+			FMDFastBindingModule::SetPropertyDirectly(ParameterProp, &NewValue, Value.Key, Value.Value);
+			bHasChanged |= NewValue != State.ScalarValue;
+			State.ScalarValue = NewValue;
+		}
+		else if (Parameter.ParameterType == EMDFastBindingMaterialParameterType::Vector)
+		{
+			FLinearColor NewValue = FLinearColor::Black;
+			FMDFastBindingModule::SetPropertyDirectly(ParameterProp, &NewValue, Value.Key, Value.Value);
+			bHasChanged |= NewValue != State.VectorValue;
+			State.VectorValue = NewValue;
+		}
+		else if (Parameter.ParameterType == EMDFastBindingMaterialParameterType::Texture)
+		{
+			UTexture* NewValue = nullptr;
+			FMDFastBindingModule::SetPropertyDirectly(ParameterProp, &NewValue, Value.Key, Value.Value);
+			bHasChanged |= NewValue != State.TextureValue.Get();
+			State.TextureValue = NewValue;
+		}
+
+		State.bIsInitialized = true;
+		if (bHasChanged)
+		{
+			PendingParameters.AddUnique(i);
+		}
+	}
+
+	if (PendingParameters.IsEmpty())
+	{
+		MarkAsHasEverUpdated();
+	}
+	else if (ShouldDeferCommit())
+	{
+		QueueCommit(TargetMaterial.Get());
+	}
+	else
+	{
+		ApplyPendingParameters();
+	}
+}
+
+void UMDFastBindingDestination_MaterialParameters::CommitDestination_Internal()
+{
+	ApplyPendingParameters();
+}
+
+void UMDFastBindingDestination_MaterialParameters::ApplyPendingParameters()
+{
+	UMaterialInstanceDynamic* Material = TargetMaterial.Get();
+	if (Material == nullptr)
+	{
+		PendingParameters.Reset();
+		return;
+	}
+
+	for (const int32 Index : PendingParameters)
+	{
+		const FMDFastBindingMaterialParameter& Parameter = Parameters[Index];
+		FParameterState& State = ParameterStates[Index];
+		if (Parameter.ParameterType == EMDFastBindingMaterialParameterType::Scalar)
+		{
+			if (State.ParameterIndex == INDEX_NONE || !Material->SetScalarParameterByIndex(State.ParameterIndex, State.ScalarValue))
+			{
+				Material->InitializeScalarParameterAndGetIndex(Parameter.ParameterName, State.ScalarValue, State.ParameterIndex);
+			}
+		}
+		else if (Parameter.ParameterType == EMDFastBindingMaterialParameterType::Vector)
+		{
+			if (State.ParameterIndex == INDEX_NONE || !Material->SetVectorParameterByIndex(State.ParameterIndex, State.VectorValue))
+			{
+				Material->InitializeVectorParameterAndGetIndex(Parameter.ParameterName, State.VectorValue, State.ParameterIndex);
+			}
+		}
+		else if (Parameter.ParameterType == EMDFastBindingMaterialParameterType::Texture)
+		{
+			Material->SetTextureParameterValue(Parameter.ParameterName, State.TextureValue.Get());
+		}
+	}
+
+	PendingParameters.Reset();
+	MarkAsHasEverUpdated();
+}
+
+void UMDFastBindingDestination_MaterialParameters::ResetParameterStates()
+{
+	ParameterStates.Reset();
+	ParameterStates.SetNum(Parameters.Num());
+	PendingParameters.Reset();
+}
+
+const FProperty* UMDFastBindingDestination_MaterialParameters::GetParameterTypeProperty(EMDFastBindingMaterialParameterType ParameterType) const
+{
+	switch (ParameterType)
+	{
+	case EMDFastBindingMaterialParameterType::Scalar:
+		return GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingDestination_MaterialParameters, ScalarProperty));
+	case EMDFastBindingMaterialParameterType::Vector:
+		return GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingDestination_MaterialParameters, VectorProperty));
+	case EMDFastBindingMaterialParameterType::Texture:
+		return GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingDestination_MaterialParameters, TextureProperty));
+	}
+
+	return nullptr;
+}
+
+void UMDFastBindingDestination_MaterialParameters::SetupBindingItems()
+{
+	Super::SetupBindingItems();
+
+	for (int32 i = BindingItems.Num() - 1; i >= 0; --i)
+	{
+		const FName& ItemName = BindingItems[i].ItemName;
+		if (ItemName != MDFastBindingDestination_MaterialParameters_Private::ImageName
+			&& !Parameters.ContainsByPredicate([&ItemName](const FMDFastBindingMaterialParameter& Parameter) { return Parameter.ParameterName == ItemName; }))
+		{
+#if WITH_EDITORONLY_DATA
+			if (BindingItems[i].Value != nullptr)
+			{
+				OrphanBindingItem(BindingItems[i].Value);
+			}
+#endif
+			BindingItems.RemoveAt(i);
+		}
+	}
+
+	EnsureBindingItemExists(MDFastBindingDestination_MaterialParameters_Private::ImageName
+		, GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingDestination_MaterialParameters, ImageProperty))
+		, LOCTEXT("ImageToolTip", "The image whose brush has the material to set the parameters on"));
+
+	for (const FMDFastBindingMaterialParameter& Parameter : Parameters)
+	{
+		if (Parameter.ParameterName != NAME_None)
+		{
+			EnsureBindingItemExists(Parameter.ParameterName
+				, GetParameterTypeProperty(Parameter.ParameterType)
+				, FText::Format(LOCTEXT("ParameterToolTip", "The value to assign to the material parameter [{0}]"), FText::FromName(Parameter.ParameterName)));
+		}
+	}
+}
+
+#if WITH_EDITOR
+EDataValidationResult UMDFastBindingDestination_MaterialParameters::IsDataValid(TArray<FText>& ValidationErrors)
+{
+	EDataValidationResult Result = Super::IsDataValid(ValidationErrors);
+
+	TSet<FName> ParameterNames;
+	for (const FMDFastBindingMaterialParameter& Parameter : Parameters)
+	{
+		if (Parameter.ParameterName == NAME_None)
+		{
+			ValidationErrors.Add(LOCTEXT("EmptyParameterName", "Material parameters must have a name"));
+			Result = EDataValidationResult::Invalid;
+		}
+		else if (Parameter.ParameterName == MDFastBindingDestination_MaterialParameters_Private::ImageName)
+		{
+			ValidationErrors.Add(FText::Format(LOCTEXT("ReservedParameterName", "Material parameter [{0}] can't share its name with the Image pin"), FText::FromName(Parameter.ParameterName)));
+			Result = EDataValidationResult::Invalid;
+		}
+		else if (ParameterNames.Contains(Parameter.ParameterName))
+		{
+			ValidationErrors.Add(FText::Format(LOCTEXT("DuplicateParameterName", "Material parameter [{0}] is used more than once"), FText::FromName(Parameter.ParameterName)));
+			Result = EDataValidationResult::Invalid;
+		}
+
+		ParameterNames.Add(Parameter.ParameterName);
+	}
+
+	return Result;
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,342 @@
+#include "BindingDestinations/MDFastBindingDestination_NativeWidget.h"
+
+#include "MDFastBinding.h"
+#include "BindingDestinations/MDFastBindingDestination_Property.h"
+#include "BindingValues/MDFastBindingValue_Property.h"
+#include "Blueprint/WidgetBlueprintGeneratedClass.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/Widget.h"
+#include "UObject/UObjectIterator.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingDestination_NativeWidget"
+
+namespace MDFastBindingDestination_NativeWidget_Private
+{
+	const FName WidgetName = TEXT("Widget");
+	const FName ValueSourceName = TEXT("Value Source");
+
+#if WITH_EDITOR
+	bool IsPropertyAWidgetInWidgetTree(const FProperty* Prop, UClass* BindingOwnerClass)
+	{
+		const FObjectPropertyBase* ObjectProp = CastField<FObjectPropertyBase>(Prop);
+		const UWidgetBlueprintGeneratedClass* WidgetClass = Cast<UWidgetBlueprintGeneratedClass>(BindingOwnerClass);
+		if (ObjectProp == nullptr || WidgetClass == nullptr || !ObjectProp->PropertyClass->IsChildOf<UWidget>())
+		{
+			return false;
+		}
+
+		const UWidgetTree* WidgetTree = WidgetClass->GetWidgetTreeArchetype();
+		if (WidgetTree == nullptr)
+		{
+			return false;
+		}
+
+		bool bFound = false;
+		WidgetTree->ForEachWidget([ObjectProp, &bFound](UWidget* Widget)
+		{
+			if (!bFound && Widget != nullptr && Widget->bIsVariable && Widget->GetFName() == ObjectProp->GetFName())
+			{
+				bFound = true;
+			}
+		});
+
+		return bFound;
+	}
+
+	void CopyBindingItem(UMDFastBindingObject& Owner, const FName& ItemName, const FMDFastBindingItem& SourceItem)
+	{
+		if (FMDFastBindingItem* Item = Owner.FindBindingItem(ItemName))
+		{
+			Item->Value = SourceItem.Value != nullptr ? DuplicateObject<UMDFastBindingValueBase>(SourceItem.Value, &Owner) : nullptr;
+			Item->DefaultString = SourceItem.DefaultString;
+			Item->DefaultText = SourceItem.DefaultText;
+			Item->DefaultObject = SourceItem.DefaultObject;
+		}
+	}
+#endif
+}
+
+void UMDFastBindingDestination_NativeWidget::BeginDestroy()
+{
+	Super::BeginDestroy();
+
+	FreeValues();
+}
+
+const FProperty* UMDFastBindingDestination_NativeWidget::GetWidgetProperty() const
+{
+	const UClass* WidgetClass = GetWidgetClass();
+	return WidgetClass != nullptr ? WidgetClass->FindPropertyByName(GetWidgetPropertyName()) : nullptr;
+}
+
+SWidget* UMDFastBindingDestination_NativeWidget::FindSlateWidgetOfType(const UWidget& Widget, const FName& SlateTypeName)
+{
+	const TSharedPtr<SWidget> SlateWidget = Widget.GetCachedWidget();
+	if (SlateWidget.IsValid() && SlateWidget->GetType() == SlateTypeName)
+	{
+		return SlateWidget.Get();
+	}
+
+	return nullptr;
+}
+
+void UMDFastBindingDestination_NativeWidget::CopyToWidgetProperty(UWidget& Widget, const void* ValuePtr) const
+{
+	if (ValueProperty != nullptr)
+	{
+		ValueProperty->CopyCompleteValue(ValueProperty->ContainerPtrToValuePtr<void>(&Widget), ValuePtr);
+	}
+}
+
+void UMDFastBindingDestination_NativeWidget::InitializeDestination_Internal(UObject* SourceObject)
+{
+	Super::InitializeDestination_Internal(SourceObject);
+
+	AllocateValues();
+}
+
+void UMDFastBindingDestination_NativeWidget::UpdateDestination_Internal(UObject* SourceObject)
+{
+	bool bDidWidgetUpdate = false;
+	const TTuple<const FProperty*, void*> WidgetValue = GetBindingItemValue(SourceObject, MDFastBindingDestination_NativeWidget_Private::WidgetName, bDidWidgetUpdate);
+	if (bDidWidgetUpdate || !TargetWidget.IsValid())
+	{
+		UObject* WidgetObject = WidgetValue.Value != nullptr ? *static_cast<UObject**>(WidgetValue.Value) : nullptr;
+		UWidget* Widget = Cast<UWidget>(WidgetObject);
+		TargetWidget = (Widget != nullptr && Widget->IsA(GetWidgetClass())) ? Widget : nullptr;
+	}
+
+	bool bDidValueUpdate = false;
+	const TTuple<const FProperty*, void*> Value = GetBindingItemValue(SourceObject, MDFastBindingDestination_NativeWidget_Private::ValueSourceName, bDidValueUpdate);
+	if (Value.Key == nullptr || Value.Value == nullptr || PendingValue == nullptr)
+	{
+		return;
+	}
+
+	UWidget* Widget = TargetWidget.Get();
+	if (Widget == nullptr)
+	{
+		return;
+	}
+
+	if (UpdateType != EMDFastBindingUpdateType::IfUpdatesNeeded || bDidWidgetUpdate || bDidValueUpdate || !HasEverUpdated())
+	{
+		if (Value.Key == ValueProperty)
+		{
+			ValueProperty->CopyCompleteValue(PendingValue, Value.Value);
+		}
+		else
+		{
+			FMDFastBindingModule::SetPropertyDirectly(ValueProperty, PendingValue, Value.Key, Value.Value);
+		}
+
+		if (ShouldDeferCommit())
+		{
+			QueueCommit(Widget);
+		}
+		else
+		{
+			ApplyPendingValue(Widget);
+		}
+	}
+}
+
+void UMDFastBindingDestination_NativeWidget::CommitDestination_Internal()
+{
+	// PendingValue is untouched until our next update
+	ApplyPendingValue(TargetWidget.Get());
+}
+
+void UMDFastBindingDestination_NativeWidget::ApplyPendingValue(UWidget* Widget)
+{
+	if (Widget == nullptr || PendingValue == nullptr)
+	{
+		return;
+	}
+
+	// Always means the setter must be called every update, even with the same value
+	const bool bSkipUnchangedValues = bSkipApplyIfValueUnchanged && UpdateType != EMDFastBindingUpdateType::Always;
+
+	// Nothing changed since our last write, skip the setter and any invalidation it would cause
+	if (bSkipUnchangedValues && bHasAppliedValue && AppliedWidget.Get() == Widget && ValueProperty->Identical(AppliedValue, PendingValue))
+	{
+		return;
+	}
+
+	ApplyValue(*Widget, PendingValue);
+
+	ValueProperty->CopyCompleteValue(AppliedValue, PendingValue);
+	AppliedWidget = Widget;
+	bHasAppliedValue = true;
+
+	MarkAsHasEverUpdated();
+}
+
+void UMDFastBindingDestination_NativeWidget::AllocateValues()
+{
+	if (PendingValue != nullptr)
+	{
+		return;
+	}
+
+	ValueProperty = GetWidgetProperty();
+	if (ValueProperty == nullptr)
+	{
+		return;
+	}
+
+	PendingValue = FMemory::Malloc(ValueProperty->GetSize(), ValueProperty->GetMinAlignment());
+	ValueProperty->InitializeValue(PendingValue);
+	AppliedValue = FMemory::Malloc(ValueProperty->GetSize(), ValueProperty->GetMinAlignment());
+	ValueProperty->InitializeValue(AppliedValue);
+}
+
+void UMDFastBindingDestination_NativeWidget::FreeValues()
+{
+	if (ValueProperty != nullptr)
+	{
+		if (PendingValue != nullptr)
+		{
+			ValueProperty->DestroyValue(PendingValue);
+			FMemory::Free(PendingValue);
+		}
+
+		if (AppliedValue != nullptr)
+		{
+			ValueProperty->DestroyValue(AppliedValue);
+			FMemory::Free(AppliedValue);
+		}
+	}
+
+	PendingValue = nullptr;
+	AppliedValue = nullptr;
+	ValueProperty = nullptr;
+	AppliedWidget.Reset();
+	bHasAppliedValue = false;
+}
+
+void UMDFastBindingDestination_NativeWidget::SetupBindingItems()
+{
+	Super::SetupBindingItems();
+
+	const UClass* WidgetClass = GetWidgetClass();
+	if (WidgetClass == nullptr)
+	{
+		return;
+	}
+
+	EnsureBindingItemExists(MDFastBindingDestination_NativeWidget_Private::WidgetName
+		, GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingDestination_NativeWidget, WidgetProperty))
+		, FText::Format(LOCTEXT("WidgetToolTip", "The {0} to set the value on. (Defaults to 'Self')."), WidgetClass->GetDisplayNameText())
+		, true);
+	EnsureBindingItemExists(MDFastBindingDestination_NativeWidget_Private::ValueSourceName
+		, GetWidgetProperty()
+		, FText::Format(LOCTEXT("ValueSourceToolTip", "The value to assign to {0}"), FText::FromName(GetWidgetPropertyName())));
+}
+
+#if WITH_EDITORONLY_DATA
+bool UMDFastBindingDestination_NativeWidget::DoesBindingItemDefaultToSelf(const FName& InItemName) const
+{
+	return InItemName == MDFastBindingDestination_NativeWidget_Private::WidgetName;
+}
+#endif
+
+#if WITH_EDITOR
+EDataValidationResult UMDFastBindingDestination_NativeWidget::IsDataValid(TArray<FText>& ValidationErrors)
+{
+	EDataValidationResult Result = Super::IsDataValid(ValidationErrors);
+
+	const UClass* WidgetClass = GetWidgetClass();
+	if (WidgetClass == nullptr || GetWidgetProperty() == nullptr)
+	{
+		ValidationErrors.Add(FText::Format(LOCTEXT("MissingWidgetProperty", "Could not find property [{0}] on the widget class"), FText::FromName(GetWidgetPropertyName())));
+		return EDataValidationResult::Invalid;
+	}
+
+	const FObjectPropertyBase* WidgetProp = CastField<const FObjectPropertyBase>(GetBindingItemValueProperty(MDFastBindingDestination_NativeWidget_Private::WidgetName));
+	const UClass* ConnectedClass = GetBindingOwnerClass();
+	if (WidgetProp != nullptr)
+	{
+		ConnectedClass = WidgetProp->PropertyClass;
+	}
+
+	if (ConnectedClass != nullptr && !ConnectedClass->IsChildOf(WidgetClass) && !WidgetClass->IsChildOf(ConnectedClass))
+	{
+		ValidationErrors.Add(FText::Format(LOCTEXT("InvalidWidgetClass", "Widget must be a {0}"), WidgetClass->GetDisplayNameText()));
+		Result = EDataValidationResult::Invalid;
+	}
+
+	return Result;
+}
+
+TSubclassOf<UMDFastBindingDestination_NativeWidget> UMDFastBindingDestination_NativeWidget::FindClassForWidgetProperty(const FProperty* WidgetProperty)
+{
+	if (WidgetProperty == nullptr)
+	{
+		return nullptr;
+	}
+
+	for (TObjectIterator<UClass> ClassIt; ClassIt; ++ClassIt)
+	{
+		if (ClassIt->IsChildOf(StaticClass()) && !ClassIt->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+		{
+			const UMDFastBindingDestination_NativeWidget* CDO = ClassIt->GetDefaultObject<UMDFastBindingDestination_NativeWidget>();
+			if (CDO != nullptr && CDO->CanReplacePropertyDestination() && CDO->GetWidgetProperty() == WidgetProperty)
+			{
+				return *ClassIt;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+UMDFastBindingDestination_NativeWidget* UMDFastBindingDestination_NativeWidget::CreateFromPropertyDestination(UMDFastBindingDestination_Property& PropertyDestination)
+{
+	const TArray<FFieldVariant> Path = PropertyDestination.GetFieldPath();
+	if (Path.Num() == 0 || Path.Num() > 2 || !Path.Last().IsA<FProperty>())
+	{
+		return nullptr;
+	}
+
+	const TSubclassOf<UMDFastBindingDestination_NativeWidget> NativeClass = FindClassForWidgetProperty(Path.Last().Get<FProperty>());
+	const FMDFastBindingItem* PathRootItem = PropertyDestination.GetPathRootItem();
+	const FMDFastBindingItem* ValueSourceItem = PropertyDestination.GetValueSourceItem();
+	if (NativeClass == nullptr || PathRootItem == nullptr || ValueSourceItem == nullptr)
+	{
+		return nullptr;
+	}
+
+	// A 2 member path must start at a widget variable on 'Self', anything else could change under us in ways the path would have picked up
+	const bool bIsWidgetVariablePath = Path.Num() == 2;
+	if (bIsWidgetVariablePath && (PathRootItem->HasValue()
+		|| !MDFastBindingDestination_NativeWidget_Private::IsPropertyAWidgetInWidgetTree(Path[0].Get<FProperty>(), PropertyDestination.GetBindingOwnerClass())))
+	{
+		return nullptr;
+	}
+
+	UMDFastBindingDestination_NativeWidget* NativeDestination = NewObject<UMDFastBindingDestination_NativeWidget>(PropertyDestination.GetOuter(), NativeClass);
+	NativeDestination->SetUpdateType(PropertyDestination.GetUpdateType());
+	NativeDestination->bSkipApplyIfValueUnchanged = PropertyDestination.ShouldSkipWriteIfValueUnchanged();
+	NativeDestination->BindingObjectIdentifier = PropertyDestination.BindingObjectIdentifier;
+	NativeDestination->SetupBindingItems_Internal();
+
+	MDFastBindingDestination_NativeWidget_Private::CopyBindingItem(*NativeDestination, MDFastBindingDestination_NativeWidget_Private::ValueSourceName, *ValueSourceItem);
+	if (bIsWidgetVariablePath)
+	{
+		// Widget tree widgets don't usually change, same as when they're dragged into the binding graph
+		UMDFastBindingValue_Property* WidgetValue = Cast<UMDFastBindingValue_Property>(NativeDestination->SetBindingItem(MDFastBindingDestination_NativeWidget_Private::WidgetName, UMDFastBindingValue_Property::StaticClass()));
+		WidgetValue->SetFieldPath({ Path[0] });
+		WidgetValue->SetUpdateType(EMDFastBindingUpdateType::Once);
+		WidgetValue->SetupBindingItems_Internal();
+	}
+	else
+	{
+		MDFastBindingDestination_NativeWidget_Private::CopyBindingItem(*NativeDestination, MDFastBindingDestination_NativeWidget_Private::WidgetName, *PathRootItem);
+	}
+
+	return NativeDestination;
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,19 @@
+#include "BindingDestinations/MDFastBindingDestination_ProgressBarPercent.h"
+
+#include "Components/ProgressBar.h"
+
+TSubclassOf<UWidget> UMDFastBindingDestination_ProgressBarPercent::GetWidgetClass() const
+{
+	return UProgressBar::StaticClass();
+}
+
+FName UMDFastBindingDestination_ProgressBarPercent::GetWidgetPropertyName() const
+{
+	static const FName PropertyName = TEXT("Percent");
+	return PropertyName;
+}
+
+void UMDFastBindingDestination_ProgressBarPercent::ApplyValue(UWidget& Widget, const void* ValuePtr) const
+{
+	static_cast<UProgressBar&>(Widget).SetPercent(*static_cast<const float*>(ValuePtr));
+}
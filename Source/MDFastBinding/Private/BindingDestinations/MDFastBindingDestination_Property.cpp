@@ -1,8 +1,11 @@
 ﻿#include "BindingDestinations/MDFastBindingDestination_Property.h"
 
 #include "INotifyFieldValueChanged.h"
+#include "BindingDestinations/MDFastBindingDestination_NativeWidget.h"
 #include "MDFastBinding.h"
+#include "MDFastBindingContainer.h"
 #include "MDFastBindingFieldPath.h"
+#include "Internationalization/Internationalization.h"
 
 #define LOCTEXT_NAMESPACE "MDFastBindingDestination_Property"
 
@@ -17,6 +20,13 @@ UMDFastBindingDestination_Property::UMDFastBindingDestination_Property()
 	PropertyPath.bOnlyAllowBlueprintReadWriteProperties = true;
 }
 
+void UMDFastBindingDestination_Property::BeginDestroy()
+{
+	Super::BeginDestroy();
+
+	FreeLastWrittenValue();
+}
+
 void UMDFastBindingDestination_Property::InitializeDestination_Internal(UObject* SourceObject)
 {
 	Super::InitializeDestination_Internal(SourceObject);
@@ -40,28 +50,142 @@ void UMDFastBindingDestination_Property::UpdateDestination_Internal(UObject* Sou
 	UObject* RootObject = GetPropertyOwner(SourceObject);
 	if (UpdateType != EMDFastBindingUpdateType::IfUpdatesNeeded || bDidUpdate || bNeedsUpdate || CheckCachedNeedsUpdate())
 	{
-		void* PropertyContainer = nullptr;
-		const TTuple<const FProperty*, void*> Property = PropertyPath.ResolvePathFromRootObject(RootObject, PropertyContainer);
-		if (Property.Key == nullptr || Property.Value == nullptr)
+		if (ShouldDeferCommit())
+		{
+			StagedRootObject = RootObject;
+			StagedValue = Value;
+			QueueCommit(RootObject);
+		}
+		else
 		{
-			return;
+			SetDestinationValue(RootObject, Value);
 		}
+	}
+}
+
+void UMDFastBindingDestination_Property::CommitDestination_Internal()
+{
+	// The staged value points to the cached value of our Value Source, which is untouched until the next update
+	SetDestinationValue(StagedRootObject.Get(), StagedValue);
+
+	StagedRootObject.Reset();
+	StagedValue = {};
+}
+
+void UMDFastBindingDestination_Property::TerminateDestination_Internal(UObject* SourceObject)
+{
+	Super::TerminateDestination_Internal(SourceObject);
+
+	if (CultureChangedHandle.IsValid())
+	{
+		FInternationalization::Get().OnCultureChanged().Remove(CultureChangedHandle);
+		CultureChangedHandle.Reset();
+	}
+}
+
+void UMDFastBindingDestination_Property::SetDestinationValue(UObject* RootObject, const TTuple<const FProperty*, void*>& Value)
+{
+	if (Value.Key == nullptr || Value.Value == nullptr)
+	{
+		return;
+	}
+
+	void* PropertyContainer = nullptr;
+	const TTuple<const FProperty*, void*> Property = PropertyPath.ResolvePathFromRootObject(RootObject, PropertyContainer);
+	if (Property.Key == nullptr || Property.Value == nullptr)
+	{
+		return;
+	}
+
+	const bool bSkipUnchangedWrites = ShouldSkipUnchangedWrites();
 
-		// Check identical before setting the new value below
-		const bool bShouldBroadcastField = BoundFieldId.IsValid() && (!HasEverUpdated() || !Property.Key->Identical(Property.Value, Value.Value));
+	// Nothing changed since our last write, skip the setter and any invalidation it would cause
+	if (bSkipUnchangedWrites && HasEverUpdated() && IsIdenticalToLastWrittenValue(PropertyContainer, Value))
+	{
+		return;
+	}
+
+	// Check identical before setting the new value below
+	const bool bShouldBroadcastField = BoundFieldId.IsValid() && (!HasEverUpdated() || !Property.Key->Identical(Property.Value, Value.Value));
+
+	FMDFastBindingModule::SetPropertyInContainer(Property.Key, PropertyContainer, Value.Key, Value.Value);
+	if (bSkipUnchangedWrites)
+	{
+		StoreLastWrittenValue(PropertyContainer, Value);
+	}
 
-		FMDFastBindingModule::SetPropertyInContainer(Property.Key, PropertyContainer, Value.Key, Value.Value);
+	if (!CultureChangedHandle.IsValid() && Property.Key->IsA<FTextProperty>() && !Value.Key->IsA<FTextProperty>())
+	{
+		CultureChangedHandle = FInternationalization::Get().OnCultureChanged().AddUObject(this, &UMDFastBindingDestination_Property::OnCultureChanged);
+	}
 
-		if (bShouldBroadcastField)
+	if (bShouldBroadcastField)
+	{
+		if (ShouldDeferCommit())
 		{
-			if (INotifyFieldValueChanged* FieldNotify = Cast<INotifyFieldValueChanged>(RootObject))
+			if (UMDFastBindingContainer* Container = GetOuterContainer())
 			{
-				FieldNotify->BroadcastFieldValueChanged(BoundFieldId);
+				Container->QueueFieldValueChangedBroadcast(RootObject, BoundFieldId);
 			}
 		}
+		else if (INotifyFieldValueChanged* FieldNotify = Cast<INotifyFieldValueChanged>(RootObject))
+		{
+			FieldNotify->BroadcastFieldValueChanged(BoundFieldId);
+		}
+	}
+
+	MarkAsHasEverUpdated();
+}
+
+bool UMDFastBindingDestination_Property::ShouldSkipUnchangedWrites() const
+{
+	// Always means the property must be written every update, even with the same value
+	return bSkipWriteIfValueUnchanged && UpdateType != EMDFastBindingUpdateType::Always;
+}
+
+bool UMDFastBindingDestination_Property::IsIdenticalToLastWrittenValue(const void* PropertyContainer, const TTuple<const FProperty*, void*>& Value) const
+{
+	return LastWrittenValue.Value != nullptr
+		&& LastWrittenContainer == PropertyContainer
+		&& LastWrittenValue.Key == Value.Key
+		&& LastWrittenValue.Key->Identical(LastWrittenValue.Value, Value.Value);
+}
+
+void UMDFastBindingDestination_Property::StoreLastWrittenValue(void* PropertyContainer, const TTuple<const FProperty*, void*>& Value)
+{
+	if (LastWrittenValue.Key != Value.Key)
+	{
+		FreeLastWrittenValue();
+	}
 
-		MarkAsHasEverUpdated();
+	if (LastWrittenValue.Value == nullptr)
+	{
+		LastWrittenValue.Key = Value.Key;
+		LastWrittenValue.Value = FMemory::Malloc(Value.Key->GetSize(), Value.Key->GetMinAlignment());
+		LastWrittenValue.Key->InitializeValue(LastWrittenValue.Value);
 	}
+
+	LastWrittenValue.Key->CopyCompleteValue(LastWrittenValue.Value, Value.Value);
+	LastWrittenContainer = PropertyContainer;
+}
+
+void UMDFastBindingDestination_Property::FreeLastWrittenValue()
+{
+	if (LastWrittenValue.Value != nullptr)
+	{
+		LastWrittenValue.Key->DestroyValue(LastWrittenValue.Value);
+		FMemory::Free(LastWrittenValue.Value);
+	}
+
+	LastWrittenValue = {};
+	LastWrittenContainer = nullptr;
+}
+
+void UMDFastBindingDestination_Property::OnCultureChanged()
+{
+	// The source value hasn't changed, so make sure the shadow copy doesn't skip the write
+	FreeLastWrittenValue();
+	MarkObjectDirty();
 }
 
 void UMDFastBindingDestination_Property::PostInitProperties()
@@ -177,6 +301,26 @@ TArray<FFieldVariant> UMDFastBindingDestination_Property::GetFieldPath()
 {
 	return PropertyPath.GetFieldPath();
 }
+
+const FMDFastBindingItem* UMDFastBindingDestination_Property::GetPathRootItem() const
+{
+	return FindBindingItem(MDFastBindingDestination_Property_Private::PathRootName);
+}
+
+const FMDFastBindingItem* UMDFastBindingDestination_Property::GetValueSourceItem() const
+{
+	return FindBindingItem(MDFastBindingDestination_Property_Private::ValueSourceName);
+}
+
+UMDFastBindingDestinationBase* UMDFastBindingDestination_Property::CreateRuntimeReplacement()
+{
+	if (!PropertyPath.BuildPath() || PropertyPath.IsLeafFunction())
+	{
+		return nullptr;
+	}
+
+	return UMDFastBindingDestination_NativeWidget::CreateFromPropertyDestination(*this);
+}
 #endif
 
 #if WITH_EDITORONLY_DATA
@@ -0,0 +1,18 @@
+#include "BindingDestinations/MDFastBindingDestination_SlateImageColor.h"
+
+#include "Widgets/Images/SImage.h"
+
+void UMDFastBindingDestination_SlateImageColor::ApplyValue(UWidget& Widget, const void* ValuePtr) const
+{
+	static const FName SlateTypeName = TEXT("SImage");
+	if (SWidget* SlateWidget = FindSlateWidgetOfType(Widget, SlateTypeName))
+	{
+		// Color only needs a repaint, SImage invalidates Paint
+		static_cast<SImage*>(SlateWidget)->SetColorAndOpacity(*static_cast<const FLinearColor*>(ValuePtr));
+		CopyToWidgetProperty(Widget, ValuePtr);
+	}
+	else
+	{
+		Super::ApplyValue(Widget, ValuePtr);
+	}
+}
@@ -0,0 +1,18 @@
+#include "BindingDestinations/MDFastBindingDestination_SlateProgressBarPercent.h"
+
+#include "Widgets/Notifications/SProgressBar.h"
+
+void UMDFastBindingDestination_SlateProgressBarPercent::ApplyValue(UWidget& Widget, const void* ValuePtr) const
+{
+	static const FName SlateTypeName = TEXT("SProgressBar");
+	if (SWidget* SlateWidget = FindSlateWidgetOfType(Widget, SlateTypeName))
+	{
+		// SProgressBar invalidates Paint, the fill doesn't change its desired size
+		static_cast<SProgressBar*>(SlateWidget)->SetPercent(TOptional<float>(*static_cast<const float*>(ValuePtr)));
+		CopyToWidgetProperty(Widget, ValuePtr);
+	}
+	else
+	{
+		Super::ApplyValue(Widget, ValuePtr);
+	}
+}
@@ -0,0 +1,18 @@
+#include "BindingDestinations/MDFastBindingDestination_SlateTextBlockColor.h"
+
+#include "Widgets/Text/STextBlock.h"
+
+void UMDFastBindingDestination_SlateTextBlockColor::ApplyValue(UWidget& Widget, const void* ValuePtr) const
+{
+	static const FName SlateTypeName = TEXT("STextBlock");
+	if (SWidget* SlateWidget = FindSlateWidgetOfType(Widget, SlateTypeName))
+	{
+		// Color only needs a repaint, STextBlock invalidates Paint
+		static_cast<STextBlock*>(SlateWidget)->SetColorAndOpacity(*static_cast<const FSlateColor*>(ValuePtr));
+		CopyToWidgetProperty(Widget, ValuePtr);
+	}
+	else
+	{
+		Super::ApplyValue(Widget, ValuePtr);
+	}
+}
@@ -0,0 +1,18 @@
+#include "BindingDestinations/MDFastBindingDestination_SlateTextBlockText.h"
+
+#include "Widgets/Text/STextBlock.h"
+
+void UMDFastBindingDestination_SlateTextBlockText::ApplyValue(UWidget& Widget, const void* ValuePtr) const
+{
+	static const FName SlateTypeName = TEXT("STextBlock");
+	if (SWidget* SlateWidget = FindSlateWidgetOfType(Widget, SlateTypeName))
+	{
+		// Text changes the desired size, so STextBlock invalidates Layout
+		static_cast<STextBlock*>(SlateWidget)->SetText(*static_cast<const FText*>(ValuePtr));
+		CopyToWidgetProperty(Widget, ValuePtr);
+	}
+	else
+	{
+		Super::ApplyValue(Widget, ValuePtr);
+	}
+}
@@ -0,0 +1,19 @@
+#include "BindingDestinations/MDFastBindingDestination_TextBlockColor.h"
+
+#include "Components/TextBlock.h"
+
+TSubclassOf<UWidget> UMDFastBindingDestination_TextBlockColor::GetWidgetClass() const
+{
+	return UTextBlock::StaticClass();
+}
+
+FName UMDFastBindingDestination_TextBlockColor::GetWidgetPropertyName() const
+{
+	static const FName PropertyName = TEXT("ColorAndOpacity");
+	return PropertyName;
+}
+
+void UMDFastBindingDestination_TextBlockColor::ApplyValue(UWidget& Widget, const void* ValuePtr) const
+{
+	static_cast<UTextBlock&>(Widget).SetColorAndOpacity(*static_cast<const FSlateColor*>(ValuePtr));
+}
@@ -0,0 +1,19 @@
+#include "BindingDestinations/MDFastBindingDestination_TextBlockText.h"
+
+#include "Components/TextBlock.h"
+
+TSubclassOf<UWidget> UMDFastBindingDestination_TextBlockText::GetWidgetClass() const
+{
+	return UTextBlock::StaticClass();
+}
+
+FName UMDFastBindingDestination_TextBlockText::GetWidgetPropertyName() const
+{
+	static const FName PropertyName = TEXT("Text");
+	return PropertyName;
+}
+
+void UMDFastBindingDestination_TextBlockText::ApplyValue(UWidget& Widget, const void* ValuePtr) const
+{
+	static_cast<UTextBlock&>(Widget).SetText(*static_cast<const FText*>(ValuePtr));
+}
@@ -0,0 +1,19 @@
+#include "BindingDestinations/MDFastBindingDestination_WidgetRenderOpacity.h"
+
+#include "Components/Widget.h"
+
+TSubclassOf<UWidget> UMDFastBindingDestination_WidgetRenderOpacity::GetWidgetClass() const
+{
+	return UWidget::StaticClass();
+}
+
+FName UMDFastBindingDestination_WidgetRenderOpacity::GetWidgetPropertyName() const
+{
+	static const FName PropertyName = TEXT("RenderOpacity");
+	return PropertyName;
+}
+
+void UMDFastBindingDestination_WidgetRenderOpacity::ApplyValue(UWidget& Widget, const void* ValuePtr) const
+{
+	Widget.SetRenderOpacity(*static_cast<const float*>(ValuePtr));
+}
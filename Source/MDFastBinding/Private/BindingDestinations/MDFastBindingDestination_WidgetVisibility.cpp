@@ -0,0 +1,19 @@
+#include "BindingDestinations/MDFastBindingDestination_WidgetVisibility.h"
+
+#include "Components/Widget.h"
+
+TSubclassOf<UWidget> UMDFastBindingDestination_WidgetVisibility::GetWidgetClass() const
+{
+	return UWidget::StaticClass();
+}
+
+FName UMDFastBindingDestination_WidgetVisibility::GetWidgetPropertyName() const
+{
+	static const FName PropertyName = TEXT("Visibility");
+	return PropertyName;
+}
+
+void UMDFastBindingDestination_WidgetVisibility::ApplyValue(UWidget& Widget, const void* ValuePtr) const
+{
+	Widget.SetVisibility(*static_cast<const ESlateVisibility*>(ValuePtr));
+}
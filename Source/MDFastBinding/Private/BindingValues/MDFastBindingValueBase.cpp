@@ -1,5 +1,7 @@
 ﻿#include "BindingValues/MDFastBindingValueBase.h"
 
+#include "Util/MDFastBindingScheduler.h"
+
 void UMDFastBindingValueBase::BeginDestroy()
 {
 	Super::BeginDestroy();
@@ -30,6 +32,11 @@ void UMDFastBindingValueBase::TerminateValue(UObject* SourceObject)
 {
 	TerminateValue_Internal(SourceObject);
 
+	if (UpdateType == EMDFastBindingUpdateType::Interval)
+	{
+		FMDFastBindingScheduler::Get().CancelWakeUp(this);
+	}
+
 	for (const FMDFastBindingItem& BindingItem : BindingItems)
 	{
 		if (BindingItem.Value != nullptr)
@@ -0,0 +1,134 @@
+#include "BindingValues/MDFastBindingValue_AsyncLoad.h"
+
+#include "MDFastBindingHelpers.h"
+#include "Engine/StreamableManager.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingValue_AsyncLoad"
+
+namespace MDFastBindingValue_AsyncLoad_Private
+{
+	const FName SoftObjectName = TEXT("Soft Object");
+	const FName PlaceholderName = TEXT("Placeholder");
+}
+
+UMDFastBindingValue_AsyncLoad::UMDFastBindingValue_AsyncLoad()
+{
+	// Updates when the soft object input changes or when a load completes
+	UpdateType = EMDFastBindingUpdateType::EventBased;
+}
+
+const FProperty* UMDFastBindingValue_AsyncLoad::GetOutputProperty()
+{
+	return GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_AsyncLoad, ObjectProperty));
+}
+
+TTuple<const FProperty*, void*> UMDFastBindingValue_AsyncLoad::GetValue_Internal(UObject* SourceObject)
+{
+	bool bDidUpdate = false;
+	const TTuple<const FProperty*, void*> SoftObjectValue = GetBindingItemValue(SourceObject, MDFastBindingValue_AsyncLoad_Private::SoftObjectName, bDidUpdate);
+
+	FSoftObjectPath Path;
+	if (const FSoftObjectProperty* SoftObjectProp = CastField<const FSoftObjectProperty>(SoftObjectValue.Key))
+	{
+		if (SoftObjectValue.Value != nullptr)
+		{
+			Path = SoftObjectProp->GetPropertyValue(SoftObjectValue.Value).ToSoftObjectPath();
+		}
+	}
+	else if (const FObjectPropertyBase* ObjectProp = CastField<const FObjectPropertyBase>(SoftObjectValue.Key))
+	{
+		// Hard references are already loaded, pass them through
+		if (SoftObjectValue.Value != nullptr)
+		{
+			Path = FSoftObjectPath(ObjectProp->GetObjectPropertyValue(SoftObjectValue.Value));
+		}
+	}
+
+	if (Path != RequestedPath)
+	{
+		RequestLoad(Path);
+	}
+
+	if (LoadHandle.IsValid() && LoadHandle->HasLoadCompleted())
+	{
+		ObjectProperty = LoadHandle->GetLoadedAsset();
+	}
+	else if (Path.IsNull())
+	{
+		ObjectProperty = nullptr;
+	}
+	else if (UObject* LoadedObject = Path.ResolveObject())
+	{
+		ObjectProperty = LoadedObject;
+	}
+	else
+	{
+		const TTuple<const FProperty*, void*> PlaceholderValue = GetBindingItemValue(SourceObject, MDFastBindingValue_AsyncLoad_Private::PlaceholderName, bDidUpdate);
+		const FObjectPropertyBase* PlaceholderProp = CastField<const FObjectPropertyBase>(PlaceholderValue.Key);
+		ObjectProperty = (PlaceholderProp != nullptr && PlaceholderValue.Value != nullptr) ? PlaceholderProp->GetObjectPropertyValue(PlaceholderValue.Value) : nullptr;
+	}
+
+	return TTuple<const FProperty*, void*>{ GetOutputProperty(), &ObjectProperty };
+}
+
+void UMDFastBindingValue_AsyncLoad::TerminateValue_Internal(UObject* SourceObject)
+{
+	Super::TerminateValue_Internal(SourceObject);
+
+	CancelLoad();
+	RequestedPath.Reset();
+	ObjectProperty = nullptr;
+}
+
+void UMDFastBindingValue_AsyncLoad::RequestLoad(const FSoftObjectPath& Path)
+{
+	CancelLoad();
+	RequestedPath = Path;
+
+	// Already loaded objects are output directly without going through the streamable manager
+	if (Path.IsNull() || Path.ResolveObject() != nullptr)
+	{
+		return;
+	}
+
+	LoadHandle = FMDFastBindingHelpers::GetStreamableManager().RequestAsyncLoad(Path
+		, FStreamableDelegate::CreateUObject(this, &UMDFastBindingValue_AsyncLoad::OnLoadCompleted), LoadPriority);
+}
+
+void UMDFastBindingValue_AsyncLoad::CancelLoad()
+{
+	if (LoadHandle.IsValid())
+	{
+		if (LoadHandle->IsLoadingInProgress())
+		{
+			LoadHandle->CancelHandle();
+		}
+		else
+		{
+			LoadHandle->ReleaseHandle();
+		}
+
+		LoadHandle.Reset();
+	}
+}
+
+void UMDFastBindingValue_AsyncLoad::OnLoadCompleted()
+{
+	// Cancelled handles don't call their complete delegate, so this is always the current request
+	MarkObjectDirty();
+}
+
+void UMDFastBindingValue_AsyncLoad::SetupBindingItems()
+{
+	Super::SetupBindingItems();
+
+	EnsureBindingItemExists(MDFastBindingValue_AsyncLoad_Private::SoftObjectName
+		, GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_AsyncLoad, SoftObjectProperty))
+		, LOCTEXT("SoftObjectToolTip", "The soft reference to load"));
+	EnsureBindingItemExists(MDFastBindingValue_AsyncLoad_Private::PlaceholderName
+		, GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_AsyncLoad, ObjectProperty))
+		, LOCTEXT("PlaceholderToolTip", "Output while the soft reference is loading")
+		, true);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,117 @@
+#include "BindingValues/MDFastBindingValue_Delegate.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingValue_Delegate"
+
+UMDFastBindingValue_Delegate::UMDFastBindingValue_Delegate()
+{
+	UpdateType = EMDFastBindingUpdateType::EventBased;
+	PropertyPath.bAllowGetterFunctions = true;
+}
+
+#if WITH_EDITOR
+EDataValidationResult UMDFastBindingValue_Delegate::IsDataValid(TArray<FText>& ValidationErrors)
+{
+	EDataValidationResult Result = Super::IsDataValid(ValidationErrors);
+
+	if (GetDelegateProperty() == nullptr)
+	{
+		Result = EDataValidationResult::Invalid;
+		ValidationErrors.Add(FText::Format(LOCTEXT("DelegateNotFoundError", "Could not find a multicast delegate named '{0}' on the path root"), FText::FromName(DelegatePropertyName)));
+	}
+
+	return Result;
+}
+#endif
+
+void UMDFastBindingValue_Delegate::InitializeValue_Internal(UObject* SourceObject)
+{
+	Super::InitializeValue_Internal(SourceObject);
+
+	BindDelegate(SourceObject);
+}
+
+TTuple<const FProperty*, void*> UMDFastBindingValue_Delegate::GetValue_Internal(UObject* SourceObject)
+{
+	// If the owner has changed, we need to rebind to the delegate
+	if (GetPropertyOwner(SourceObject) != BoundObject.Get())
+	{
+		BindDelegate(SourceObject);
+	}
+
+	return Super::GetValue_Internal(SourceObject);
+}
+
+void UMDFastBindingValue_Delegate::TerminateValue_Internal(UObject* SourceObject)
+{
+	Super::TerminateValue_Internal(SourceObject);
+
+	UnbindDelegate();
+}
+
+void UMDFastBindingValue_Delegate::OnDelegateBroadcast()
+{
+	MarkObjectDirty();
+}
+
+TArray<FName> UMDFastBindingValue_Delegate::GetDelegatePropertyNames()
+{
+	TArray<FName> Names;
+	if (const UStruct* OwnerStruct = GetPropertyOwnerStruct())
+	{
+		for (TFieldIterator<FMulticastDelegateProperty> It(OwnerStruct); It; ++It)
+		{
+			Names.Add(It->GetFName());
+		}
+	}
+
+	return Names;
+}
+
+const FMulticastDelegateProperty* UMDFastBindingValue_Delegate::GetDelegateProperty()
+{
+	if (const UStruct* OwnerStruct = GetPropertyOwnerStruct())
+	{
+		return FindFProperty<FMulticastDelegateProperty>(OwnerStruct, DelegatePropertyName);
+	}
+
+	return nullptr;
+}
+
+void UMDFastBindingValue_Delegate::BindDelegate(UObject* SourceObject)
+{
+	UnbindDelegate();
+
+	UObject* PropertyOwner = GetPropertyOwner(SourceObject);
+	if (PropertyOwner == nullptr)
+	{
+		return;
+	}
+
+	// Look the delegate up on the owner's actual class in case the path root is typed as a base class
+	if (const FMulticastDelegateProperty* DelegateProp = FindFProperty<FMulticastDelegateProperty>(PropertyOwner->GetClass(), DelegatePropertyName))
+	{
+		FScriptDelegate Delegate;
+		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UMDFastBindingValue_Delegate, OnDelegateBroadcast));
+		DelegateProp->AddDelegate(MoveTemp(Delegate), PropertyOwner);
+
+		BoundObject = PropertyOwner;
+		BoundDelegateProperty = DelegateProp;
+	}
+}
+
+void UMDFastBindingValue_Delegate::UnbindDelegate()
+{
+	UObject* Object = BoundObject.Get();
+	const FMulticastDelegateProperty* DelegateProp = BoundDelegateProperty.Get();
+	if (Object != nullptr && DelegateProp != nullptr)
+	{
+		FScriptDelegate Delegate;
+		Delegate.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UMDFastBindingValue_Delegate, OnDelegateBroadcast));
+		DelegateProp->RemoveDelegate(Delegate, Object);
+	}
+
+	BoundObject.Reset();
+	BoundDelegateProperty.Reset();
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,798 @@
+#include "BindingValues/MDFastBindingValue_Expression.h"
+
+#include "Algo/Find.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingValue_Expression"
+
+#if WITH_EDITOR
+namespace MDFastBindingValue_Expression_Private
+{
+	// Recursive descent parser that type checks the expression and emits register instructions as it goes
+	class FExpressionCompiler
+	{
+	public:
+		explicit FExpressionCompiler(const FString& InSource)
+			: Source(InSource)
+		{
+		}
+
+		bool Compile(TArray<FMDFastBindingExpressionInput>& OutInputs, TArray<double>& OutConstants, TArray<FMDFastBindingExpressionInstruction>& OutInstructions
+			, int32& OutNumRegisters, int32& OutResultRegister, bool& bOutReturnsBool, FText& OutError)
+		{
+			FOperand Result = ParseTernary();
+			SkipWhitespace();
+			if (!HasError() && Pos < Source.Len())
+			{
+				SetError(FText::Format(LOCTEXT("UnexpectedCharacter", "Unexpected '{0}' at position {1}"), FText::FromString(Source.Mid(Pos, 1)), FText::AsNumber(Pos)));
+			}
+
+			if (!HasError() && GetType(Result) == EType::Unknown)
+			{
+				Require(Result, EType::Number);
+			}
+
+			const int32 NumInputs = InputNames.Num();
+			const int32 TotalRegisters = NumInputs + Constants.Num() + NumTemps;
+			if (!HasError() && TotalRegisters > MAX_uint8 + 1)
+			{
+				SetError(LOCTEXT("TooManyRegisters", "Expression is too long, split it into multiple expressions"));
+			}
+
+			if (HasError())
+			{
+				OutError = Error;
+				return false;
+			}
+
+			OutInputs.Reset(NumInputs);
+			for (int32 i = 0; i < NumInputs; ++i)
+			{
+				OutInputs.Add({ InputNames[i], InputTypes[i] == EType::Bool });
+			}
+
+			OutConstants = Constants;
+
+			OutInstructions.Reset(PendingInstructions.Num());
+			for (const FPendingInstruction& Pending : PendingInstructions)
+			{
+				FMDFastBindingExpressionInstruction& Instruction = OutInstructions.AddDefaulted_GetRef();
+				Instruction.Op = static_cast<uint8>(Pending.Op);
+				Instruction.Result = static_cast<uint8>(GetRegister(Pending.Result));
+				Instruction.A = static_cast<uint8>(GetRegister(Pending.Operands[0]));
+				Instruction.B = static_cast<uint8>(GetRegister(Pending.Operands[1]));
+				Instruction.C = static_cast<uint8>(GetRegister(Pending.Operands[2]));
+			}
+
+			OutNumRegisters = TotalRegisters;
+			OutResultRegister = GetRegister(Result);
+			bOutReturnsBool = GetType(Result) == EType::Bool;
+			return true;
+		}
+
+	private:
+		enum class EType : uint8
+		{
+			Unknown,
+			Number,
+			Bool
+		};
+
+		enum class ERegisterKind : uint8
+		{
+			Input,
+			Constant,
+			Temp
+		};
+
+		struct FOperand
+		{
+			ERegisterKind Kind = ERegisterKind::Constant;
+			int32 Index = 0;
+			EType Type = EType::Number;
+		};
+
+		struct FPendingInstruction
+		{
+			EMDFastBindingExpressionOp Op;
+			FOperand Result;
+			FOperand Operands[3];
+		};
+
+		struct FFunctionInfo
+		{
+			const TCHAR* Name;
+			EMDFastBindingExpressionOp Op;
+			int32 NumArgs;
+		};
+
+		bool HasError() const { return !Error.IsEmpty(); }
+
+		void SetError(const FText& InError)
+		{
+			if (!HasError())
+			{
+				Error = InError;
+			}
+		}
+
+		int32 GetRegister(const FOperand& Operand) const
+		{
+			switch (Operand.Kind)
+			{
+			case ERegisterKind::Input:
+				return Operand.Index;
+			case ERegisterKind::Constant:
+				return InputNames.Num() + Operand.Index;
+			case ERegisterKind::Temp:
+				return InputNames.Num() + Constants.Num() + Operand.Index;
+			}
+
+			return 0;
+		}
+
+		// An input's operand only has its type from when it was parsed, later uses of the same input may have typed it since
+		EType GetType(const FOperand& Operand) const
+		{
+			return Operand.Kind == ERegisterKind::Input ? InputTypes[Operand.Index] : Operand.Type;
+		}
+
+		void Require(FOperand& Operand, EType Type)
+		{
+			const EType CurrentType = GetType(Operand);
+			if (CurrentType == EType::Unknown && Operand.Kind == ERegisterKind::Input)
+			{
+				InputTypes[Operand.Index] = Type;
+				Operand.Type = Type;
+			}
+			else if (CurrentType != Type)
+			{
+				SetError(Type == EType::Bool
+					? LOCTEXT("ExpectedBool", "Expected a true/false value but found a number")
+					: LOCTEXT("ExpectedNumber", "Expected a number but found a true/false value"));
+			}
+		}
+
+		void Unify(FOperand& A, FOperand& B)
+		{
+			const EType TypeA = GetType(A);
+			const EType TypeB = GetType(B);
+			if (TypeA == EType::Unknown && TypeB == EType::Unknown)
+			{
+				Require(A, EType::Number);
+				Require(B, EType::Number);
+			}
+			else if (TypeA == EType::Unknown)
+			{
+				Require(A, TypeB);
+			}
+			else
+			{
+				Require(B, TypeA);
+			}
+		}
+
+		FOperand Emit(EMDFastBindingExpressionOp Op, EType ResultType, const FOperand& A, const FOperand& B = {}, const FOperand& C = {})
+		{
+			const FOperand Result = { ERegisterKind::Temp, NumTemps++, ResultType };
+			PendingInstructions.Add({ Op, Result, { A, B, C } });
+			return Result;
+		}
+
+		FOperand AddConstant(double Value, EType Type)
+		{
+			int32 Index = Constants.IndexOfByKey(Value);
+			if (Index == INDEX_NONE)
+			{
+				Index = Constants.Add(Value);
+			}
+
+			return { ERegisterKind::Constant, Index, Type };
+		}
+
+		FOperand AddInput(const FString& Name)
+		{
+			const FName InputName = FName(*Name);
+			int32 Index = InputNames.IndexOfByKey(InputName);
+			if (Index == INDEX_NONE)
+			{
+				Index = InputNames.Add(InputName);
+				InputTypes.Add(EType::Unknown);
+			}
+
+			return { ERegisterKind::Input, Index, InputTypes[Index] };
+		}
+
+		void SkipWhitespace()
+		{
+			while (Pos < Source.Len() && FChar::IsWhitespace(Source[Pos]))
+			{
+				++Pos;
+			}
+		}
+
+		bool Match(const TCHAR* Token)
+		{
+			SkipWhitespace();
+			const int32 TokenLen = FCString::Strlen(Token);
+			if (FCString::Strncmp(*Source + Pos, Token, TokenLen) == 0)
+			{
+				Pos += TokenLen;
+				return true;
+			}
+
+			return false;
+		}
+
+		void Expect(const TCHAR* Token)
+		{
+			if (!HasError() && !Match(Token))
+			{
+				SetError(FText::Format(LOCTEXT("ExpectedToken", "Expected '{0}' at position {1}"), FText::FromString(Token), FText::AsNumber(Pos)));
+			}
+		}
+
+		FOperand ParseTernary()
+		{
+			FOperand Condition = ParseOr();
+			if (Match(TEXT("?")))
+			{
+				Require(Condition, EType::Bool);
+				FOperand A = ParseTernary();
+				Expect(TEXT(":"));
+				FOperand B = ParseTernary();
+				Unify(A, B);
+				return Emit(EMDFastBindingExpressionOp::Select, GetType(A), Condition, A, B);
+			}
+
+			return Condition;
+		}
+
+		FOperand ParseOr()
+		{
+			FOperand Left = ParseAnd();
+			while (!HasError() && Match(TEXT("||")))
+			{
+				FOperand Right = ParseAnd();
+				Require(Left, EType::Bool);
+				Require(Right, EType::Bool);
+				Left = Emit(EMDFastBindingExpressionOp::Or, EType::Bool, Left, Right);
+			}
+
+			return Left;
+		}
+
+		FOperand ParseAnd()
+		{
+			FOperand Left = ParseEquality();
+			while (!HasError() && Match(TEXT("&&")))
+			{
+				FOperand Right = ParseEquality();
+				Require(Left, EType::Bool);
+				Require(Right, EType::Bool);
+				Left = Emit(EMDFastBindingExpressionOp::And, EType::Bool, Left, Right);
+			}
+
+			return Left;
+		}
+
+		FOperand ParseEquality()
+		{
+			FOperand Left = ParseComparison();
+			while (!HasError())
+			{
+				EMDFastBindingExpressionOp Op;
+				if (Match(TEXT("==")))
+				{
+					Op = EMDFastBindingExpressionOp::Equal;
+				}
+				else if (Match(TEXT("!=")))
+				{
+					Op = EMDFastBindingExpressionOp::NotEqual;
+				}
+				else
+				{
+					break;
+				}
+
+				FOperand Right = ParseComparison();
+				Unify(Left, Right);
+				Left = Emit(Op, EType::Bool, Left, Right);
+			}
+
+			return Left;
+		}
+
+		FOperand ParseComparison()
+		{
+			FOperand Left = ParseAdditive();
+			while (!HasError())
+			{
+				EMDFastBindingExpressionOp Op;
+				if (Match(TEXT("<=")))
+				{
+					Op = EMDFastBindingExpressionOp::LessOrEqual;
+				}
+				else if (Match(TEXT(">=")))
+				{
+					Op = EMDFastBindingExpressionOp::GreaterOrEqual;
+				}
+				else if (Match(TEXT("<")))
+				{
+					Op = EMDFastBindingExpressionOp::Less;
+				}
+				else if (Match(TEXT(">")))
+				{
+					Op = EMDFastBindingExpressionOp::Greater;
+				}
+				else
+				{
+					break;
+				}
+
+				FOperand Right = ParseAdditive();
+				Require(Left, EType::Number);
+				Require(Right, EType::Number);
+				Left = Emit(Op, EType::Bool, Left, Right);
+			}
+
+			return Left;
+		}
+
+		FOperand ParseAdditive()
+		{
+			FOperand Left = ParseMultiplicative();
+			while (!HasError())
+			{
+				EMDFastBindingExpressionOp Op;
+				if (Match(TEXT("+")))
+				{
+					Op = EMDFastBindingExpressionOp::Add;
+				}
+				else if (Match(TEXT("-")))
+				{
+					Op = EMDFastBindingExpressionOp::Subtract;
+				}
+				else
+				{
+					break;
+				}
+
+				FOperand Right = ParseMultiplicative();
+				Require(Left, EType::Number);
+				Require(Right, EType::Number);
+				Left = Emit(Op, EType::Number, Left, Right);
+			}
+
+			return Left;
+		}
+
+		FOperand ParseMultiplicative()
+		{
+			FOperand Left = ParseUnary();
+			while (!HasError())
+			{
+				EMDFastBindingExpressionOp Op;
+				if (Match(TEXT("*")))
+				{
+					Op = EMDFastBindingExpressionOp::Multiply;
+				}
+				else if (Match(TEXT("/")))
+				{
+					Op = EMDFastBindingExpressionOp::Divide;
+				}
+				else if (Match(TEXT("%")))
+				{
+					Op = EMDFastBindingExpressionOp::Modulo;
+				}
+				else
+				{
+					break;
+				}
+
+				FOperand Right = ParseUnary();
+				Require(Left, EType::Number);
+				Require(Right, EType::Number);
+				Left = Emit(Op, EType::Number, Left, Right);
+			}
+
+			return Left;
+		}
+
+		FOperand ParseUnary()
+		{
+			if (Match(TEXT("-")))
+			{
+				FOperand Operand = ParseUnary();
+				Require(Operand, EType::Number);
+				return Emit(EMDFastBindingExpressionOp::Negate, EType::Number, Operand);
+			}
+
+			if (Match(TEXT("+")))
+			{
+				FOperand Operand = ParseUnary();
+				Require(Operand, EType::Number);
+				return Operand;
+			}
+
+			// Don't consume the start of !=, which isn't valid here anyway
+			SkipWhitespace();
+			if (Pos + 1 < Source.Len() && Source[Pos] == TEXT('!') && Source[Pos + 1] != TEXT('='))
+			{
+				++Pos;
+				FOperand Operand = ParseUnary();
+				Require(Operand, EType::Bool);
+				return Emit(EMDFastBindingExpressionOp::Not, EType::Bool, Operand);
+			}
+
+			return ParsePrimary();
+		}
+
+		FOperand ParsePrimary()
+		{
+			SkipWhitespace();
+			if (HasError())
+			{
+				return {};
+			}
+
+			if (Pos >= Source.Len())
+			{
+				SetError(LOCTEXT("UnexpectedEnd", "Unexpected end of expression"));
+				return {};
+			}
+
+			if (Match(TEXT("(")))
+			{
+				FOperand Inner = ParseTernary();
+				Expect(TEXT(")"));
+				return Inner;
+			}
+
+			const TCHAR FirstChar = Source[Pos];
+			if (FChar::IsDigit(FirstChar) || FirstChar == TEXT('.'))
+			{
+				const int32 Start = Pos;
+				while (Pos < Source.Len() && (FChar::IsDigit(Source[Pos]) || Source[Pos] == TEXT('.')))
+				{
+					++Pos;
+				}
+
+				if (Pos < Source.Len() && (Source[Pos] == TEXT('e') || Source[Pos] == TEXT('E')))
+				{
+					++Pos;
+					if (Pos < Source.Len() && (Source[Pos] == TEXT('+') || Source[Pos] == TEXT('-')))
+					{
+						++Pos;
+					}
+
+					while (Pos < Source.Len() && FChar::IsDigit(Source[Pos]))
+					{
+						++Pos;
+					}
+				}
+
+				return AddConstant(FCString::Atod(*Source.Mid(Start, Pos - Start)), EType::Number);
+			}
+
+			if (FChar::IsAlpha(FirstChar) || FirstChar == TEXT('_'))
+			{
+				const int32 Start = Pos;
+				while (Pos < Source.Len() && (FChar::IsAlnum(Source[Pos]) || Source[Pos] == TEXT('_')))
+				{
+					++Pos;
+				}
+
+				const FString Identifier = Source.Mid(Start, Pos - Start);
+				if (Identifier == TEXT("true"))
+				{
+					return AddConstant(1.0, EType::Bool);
+				}
+
+				if (Identifier == TEXT("false"))
+				{
+					return AddConstant(0.0, EType::Bool);
+				}
+
+				if (Match(TEXT("(")))
+				{
+					return ParseFunction(Identifier);
+				}
+
+				return AddInput(Identifier);
+			}
+
+			SetError(FText::Format(LOCTEXT("UnexpectedCharacter", "Unexpected '{0}' at position {1}"), FText::FromString(Source.Mid(Pos, 1)), FText::AsNumber(Pos)));
+			return {};
+		}
+
+		FOperand ParseFunction(const FString& Name)
+		{
+			static const FFunctionInfo Functions[] =
+			{
+				{ TEXT("min"), EMDFastBindingExpressionOp::Min, 2 },
+				{ TEXT("max"), EMDFastBindingExpressionOp::Max, 2 },
+				{ TEXT("clamp"), EMDFastBindingExpressionOp::Clamp, 3 },
+				{ TEXT("abs"), EMDFastBindingExpressionOp::Abs, 1 },
+				{ TEXT("floor"), EMDFastBindingExpressionOp::Floor, 1 },
+				{ TEXT("ceil"), EMDFastBindingExpressionOp::Ceil, 1 },
+				{ TEXT("round"), EMDFastBindingExpressionOp::Round, 1 },
+				{ TEXT("sqrt"), EMDFastBindingExpressionOp::Sqrt, 1 },
+				{ TEXT("pow"), EMDFastBindingExpressionOp::Pow, 2 },
+				{ TEXT("lerp"), EMDFastBindingExpressionOp::Lerp, 3 }
+			};
+
+			const FFunctionInfo* Function = Algo::FindByPredicate(Functions, [&Name](const FFunctionInfo& Info) { return Name.Equals(Info.Name, ESearchCase::IgnoreCase); });
+			if (Function == nullptr)
+			{
+				SetError(FText::Format(LOCTEXT("UnknownFunction", "Unknown function '{0}'"), FText::FromString(Name)));
+				return {};
+			}
+
+			FOperand Args[3];
+			for (int32 i = 0; i < Function->NumArgs && !HasError(); ++i)
+			{
+				if (i > 0)
+				{
+					Expect(TEXT(","));
+				}
+
+				Args[i] = ParseTernary();
+				Require(Args[i], EType::Number);
+			}
+
+			Expect(TEXT(")"));
+			return Emit(Function->Op, EType::Number, Args[0], Args[1], Args[2]);
+		}
+
+		const FString& Source;
+		int32 Pos = 0;
+		FText Error;
+
+		TArray<FName> InputNames;
+		TArray<EType> InputTypes;
+		TArray<double> Constants;
+		TArray<FPendingInstruction> PendingInstructions;
+		int32 NumTemps = 0;
+	};
+}
+#endif
+
+const FProperty* UMDFastBindingValue_Expression::GetOutputProperty()
+{
+	return bReturnsBool
+		? GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Expression, BoolValue))
+		: GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Expression, NumberValue));
+}
+
+void UMDFastBindingValue_Expression::InitializeValue_Internal(UObject* SourceObject)
+{
+	Super::InitializeValue_Internal(SourceObject);
+
+	Registers.Reset();
+	Registers.SetNumZeroed(NumRegisters);
+	for (int32 i = 0; i < Constants.Num(); ++i)
+	{
+		Registers[Inputs.Num() + i] = Constants[i];
+	}
+
+	bHasEvaluated = false;
+}
+
+TTuple<const FProperty*, void*> UMDFastBindingValue_Expression::GetValue_Internal(UObject* SourceObject)
+{
+	void* OutputPtr = bReturnsBool ? static_cast<void*>(&BoolValue) : static_cast<void*>(&NumberValue);
+	if (!Registers.IsValidIndex(ResultRegister) || Registers.Num() < Inputs.Num())
+	{
+		return TTuple<const FProperty*, void*>{ GetOutputProperty(), OutputPtr };
+	}
+
+	bool bNeedsUpdate = UpdateType != EMDFastBindingUpdateType::IfUpdatesNeeded || !bHasEvaluated;
+	for (int32 i = 0; i < Inputs.Num(); ++i)
+	{
+		bool bDidUpdate = false;
+		const TTuple<const FProperty*, void*> InputValue = GetBindingItemValue(SourceObject, Inputs[i].Name, bDidUpdate);
+		if ((bDidUpdate || !bHasEvaluated) && InputValue.Key != nullptr && InputValue.Value != nullptr)
+		{
+			Registers[i] = ReadInput(InputValue.Key, InputValue.Value);
+			bNeedsUpdate = true;
+		}
+	}
+
+	if (bNeedsUpdate)
+	{
+		Execute();
+		NumberValue = Registers[ResultRegister];
+		BoolValue = Registers[ResultRegister] != 0.0;
+		bHasEvaluated = true;
+	}
+
+	return TTuple<const FProperty*, void*>{ GetOutputProperty(), OutputPtr };
+}
+
+void UMDFastBindingValue_Expression::Execute()
+{
+	double* R = Registers.GetData();
+	for (const FMDFastBindingExpressionInstruction& Instruction : Instructions)
+	{
+		const double A = R[Instruction.A];
+		const double B = R[Instruction.B];
+		double& Out = R[Instruction.Result];
+		switch (static_cast<EMDFastBindingExpressionOp>(Instruction.Op))
+		{
+		case EMDFastBindingExpressionOp::Add:
+			Out = A + B;
+			break;
+		case EMDFastBindingExpressionOp::Subtract:
+			Out = A - B;
+			break;
+		case EMDFastBindingExpressionOp::Multiply:
+			Out = A * B;
+			break;
+		case EMDFastBindingExpressionOp::Divide:
+			Out = B != 0.0 ? A / B : 0.0;
+			break;
+		case EMDFastBindingExpressionOp::Modulo:
+			Out = B != 0.0 ? FMath::Fmod(A, B) : 0.0;
+			break;
+		case EMDFastBindingExpressionOp::Negate:
+			Out = -A;
+			break;
+		case EMDFastBindingExpressionOp::Not:
+			Out = A == 0.0 ? 1.0 : 0.0;
+			break;
+		case EMDFastBindingExpressionOp::Less:
+			Out = A < B ? 1.0 : 0.0;
+			break;
+		case EMDFastBindingExpressionOp::LessOrEqual:
+			Out = A <= B ? 1.0 : 0.0;
+			break;
+		case EMDFastBindingExpressionOp::Greater:
+			Out = A > B ? 1.0 : 0.0;
+			break;
+		case EMDFastBindingExpressionOp::GreaterOrEqual:
+			Out = A >= B ? 1.0 : 0.0;
+			break;
+		case EMDFastBindingExpressionOp::Equal:
+			Out = A == B ? 1.0 : 0.0;
+			break;
+		case EMDFastBindingExpressionOp::NotEqual:
+			Out = A != B ? 1.0 : 0.0;
+			break;
+		case EMDFastBindingExpressionOp::And:
+			Out = (A != 0.0 && B != 0.0) ? 1.0 : 0.0;
+			break;
+		case EMDFastBindingExpressionOp::Or:
+			Out = (A != 0.0 || B != 0.0) ? 1.0 : 0.0;
+			break;
+		case EMDFastBindingExpressionOp::Select:
+			Out = A != 0.0 ? B : R[Instruction.C];
+			break;
+		case EMDFastBindingExpressionOp::Min:
+			Out = FMath::Min(A, B);
+			break;
+		case EMDFastBindingExpressionOp::Max:
+			Out = FMath::Max(A, B);
+			break;
+		case EMDFastBindingExpressionOp::Clamp:
+			Out = FMath::Clamp(A, B, R[Instruction.C]);
+			break;
+		case EMDFastBindingExpressionOp::Abs:
+			Out = FMath::Abs(A);
+			break;
+		case EMDFastBindingExpressionOp::Floor:
+			Out = FMath::FloorToDouble(A);
+			break;
+		case EMDFastBindingExpressionOp::Ceil:
+			Out = FMath::CeilToDouble(A);
+			break;
+		case EMDFastBindingExpressionOp::Round:
+			Out = FMath::RoundToDouble(A);
+			break;
+		case EMDFastBindingExpressionOp::Sqrt:
+			Out = A > 0.0 ? FMath::Sqrt(A) : 0.0;
+			break;
+		case EMDFastBindingExpressionOp::Pow:
+			Out = FMath::Pow(A, B);
+			break;
+		case EMDFastBindingExpressionOp::Lerp:
+			Out = A + (B - A) * R[Instruction.C];
+			break;
+		}
+	}
+}
+
+double UMDFastBindingValue_Expression::ReadInput(const FProperty* InputProp, const void* InputValuePtr) const
+{
+	if (const FBoolProperty* BoolProp = CastField<const FBoolProperty>(InputProp))
+	{
+		return BoolProp->GetPropertyValue(InputValuePtr) ? 1.0 : 0.0;
+	}
+
+	if (const FNumericProperty* NumericProp = CastField<const FNumericProperty>(InputProp))
+	{
+		return NumericProp->IsFloatingPoint()
+			? NumericProp->GetFloatingPointPropertyValue(InputValuePtr)
+			: static_cast<double>(NumericProp->GetSignedIntPropertyValue(InputValuePtr));
+	}
+
+	if (const FEnumProperty* EnumProp = CastField<const FEnumProperty>(InputProp))
+	{
+		return static_cast<double>(EnumProp->GetUnderlyingProperty()->GetSignedIntPropertyValue(InputValuePtr));
+	}
+
+	return 0.0;
+}
+
+void UMDFastBindingValue_Expression::SetupBindingItems()
+{
+	Super::SetupBindingItems();
+
+#if WITH_EDITOR
+	FText CompileError;
+	CompileExpression(CompileError);
+#endif
+
+	for (int32 i = BindingItems.Num() - 1; i >= 0; --i)
+	{
+		const FName& ItemName = BindingItems[i].ItemName;
+		if (!Inputs.ContainsByPredicate([&ItemName](const FMDFastBindingExpressionInput& Input) { return Input.Name == ItemName; }))
+		{
+#if WITH_EDITORONLY_DATA
+			if (BindingItems[i].Value != nullptr)
+			{
+				OrphanBindingItem(BindingItems[i].Value);
+			}
+#endif
+			BindingItems.RemoveAt(i);
+		}
+	}
+
+	const FProperty* NumberProp = GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Expression, NumberValue));
+	const FProperty* BoolProp = GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Expression, BoolValue));
+	for (const FMDFastBindingExpressionInput& Input : Inputs)
+	{
+		EnsureBindingItemExists(Input.Name, Input.bIsBool ? BoolProp : NumberProp, FText::GetEmpty());
+	}
+}
+
+#if WITH_EDITOR
+bool UMDFastBindingValue_Expression::CompileExpression(FText& OutError)
+{
+	MDFastBindingValue_Expression_Private::FExpressionCompiler Compiler(Expression);
+
+	TArray<FMDFastBindingExpressionInput> CompiledInputs;
+	if (!Compiler.Compile(CompiledInputs, Constants, Instructions, NumRegisters, ResultRegister, bReturnsBool, OutError))
+	{
+		// Keep the existing pins so connections aren't lost while the expression is being edited
+		Constants.Reset();
+		Instructions.Reset();
+		NumRegisters = 0;
+		ResultRegister = 0;
+		return false;
+	}
+
+	Inputs = MoveTemp(CompiledInputs);
+	return true;
+}
+
+EDataValidationResult UMDFastBindingValue_Expression::IsDataValid(TArray<FText>& ValidationErrors)
+{
+	FText CompileError;
+	if (!CompileExpression(CompileError))
+	{
+		ValidationErrors.Add(CompileError);
+		return EDataValidationResult::Invalid;
+	}
+
+	return Super::IsDataValid(ValidationErrors);
+}
+#endif
+
+#if WITH_EDITORONLY_DATA
+FText UMDFastBindingValue_Expression::GetDisplayName()
+{
+	return FText::FromString(Expression);
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
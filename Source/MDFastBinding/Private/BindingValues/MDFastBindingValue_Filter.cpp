@@ -0,0 +1,108 @@
+#include "BindingValues/MDFastBindingValue_Filter.h"
+
+#include "MDFastBinding.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingValue_Filter"
+
+namespace MDFastBindingValue_Filter_Private
+{
+	const FName ValueName = TEXT("Value");
+}
+
+const FProperty* UMDFastBindingValue_Filter::GetOutputProperty()
+{
+	return GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Filter, OutputValue));
+}
+
+#if WITH_EDITORONLY_DATA
+FText UMDFastBindingValue_Filter::GetDisplayName()
+{
+	if (const UEnum* ModeEnum = StaticEnum<EMDFastBindingFilterMode>())
+	{
+		return ModeEnum->GetDisplayNameTextByValue(static_cast<int64>(FilterMode));
+	}
+
+	return Super::GetDisplayName();
+}
+#endif
+
+#if WITH_EDITOR
+EDataValidationResult UMDFastBindingValue_Filter::IsDataValid(TArray<FText>& ValidationErrors)
+{
+	if (FilterMode == EMDFastBindingFilterMode::Quantize && Step <= 0.0)
+	{
+		ValidationErrors.Add(LOCTEXT("InvalidStep", "Step must be greater than 0 to quantize"));
+		return EDataValidationResult::Invalid;
+	}
+
+	return Super::IsDataValid(ValidationErrors);
+}
+#endif
+
+void UMDFastBindingValue_Filter::InitializeValue_Internal(UObject* SourceObject)
+{
+	Super::InitializeValue_Internal(SourceObject);
+
+	OutputValue = 0.0;
+	bHasOutput = false;
+}
+
+TTuple<const FProperty*, void*> UMDFastBindingValue_Filter::GetValue_Internal(UObject* SourceObject)
+{
+	bool bDidUpdate = false;
+	const TTuple<const FProperty*, void*> Input = GetBindingItemValue(SourceObject, MDFastBindingValue_Filter_Private::ValueName, bDidUpdate);
+	if (Input.Key != nullptr && Input.Value != nullptr)
+	{
+		const FProperty* ValueInputProp = GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Filter, ValueInput));
+		if (Input.Key->SameType(ValueInputProp))
+		{
+			ValueInput = *static_cast<const double*>(Input.Value);
+		}
+		else
+		{
+			FMDFastBindingModule::SetPropertyDirectly(ValueInputProp, &ValueInput, Input.Key, Input.Value);
+		}
+
+		ApplyFilter(ValueInput);
+	}
+
+	// Returning an unchanged output is what keeps everything downstream from updating
+	return TTuple<const FProperty*, void*>{ GetOutputProperty(), &OutputValue };
+}
+
+void UMDFastBindingValue_Filter::ApplyFilter(double InputValue)
+{
+	if (FilterMode == EMDFastBindingFilterMode::Deadband)
+	{
+		if (!bHasOutput || FMath::Abs(InputValue - OutputValue) > Threshold)
+		{
+			OutputValue = InputValue;
+		}
+	}
+	else if (Step > 0.0)
+	{
+		const double Quantized = FMath::GridSnap(InputValue, Step);
+		// The input has to cross the midpoint between steps by the hysteresis amount before the output moves
+		if (!bHasOutput || (Quantized != OutputValue && FMath::Abs(InputValue - OutputValue) >= Step * 0.5 + Hysteresis))
+		{
+			OutputValue = Quantized;
+		}
+	}
+	else
+	{
+		OutputValue = InputValue;
+	}
+
+	bHasOutput = true;
+}
+
+void UMDFastBindingValue_Filter::SetupBindingItems()
+{
+	Super::SetupBindingItems();
+
+	EnsureBindingItemExists(MDFastBindingValue_Filter_Private::ValueName
+		, GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Filter, ValueInput))
+		, LOCTEXT("ValueToolTip", "The noisy value to filter"));
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -1,46 +1,178 @@
 ﻿#include "BindingValues/MDFastBindingValue_FormatText.h"
 
 #include "MDFastBinding.h"
+#include "Internationalization/Internationalization.h"
+#include "PropertySetters/MDFastBindingPropertySetter_Text.h"
+
+EMDFastBindingUpdateType UMDFastBindingValue_FormatText::GetEffectiveUpdateType() const
+{
+	// The output only depends on the arguments and the culture, which both tell us when they change
+	if (UpdateType == EMDFastBindingUpdateType::Always)
+	{
+		return EMDFastBindingUpdateType::IfUpdatesNeeded;
+	}
+
+	return Super::GetEffectiveUpdateType();
+}
+
+void UMDFastBindingValue_FormatText::InitializeValue_Internal(UObject* SourceObject)
+{
+	Super::InitializeValue_Internal(SourceObject);
+
+	bIsFormatCompiled = false;
+
+	if (!CultureChangedHandle.IsValid())
+	{
+		CultureChangedHandle = FInternationalization::Get().OnCultureChanged().AddUObject(this, &UMDFastBindingValue_FormatText::OnCultureChanged);
+	}
+}
 
 TTuple<const FProperty*, void*> UMDFastBindingValue_FormatText::GetValue_Internal(UObject* SourceObject)
 {
-#if !WITH_EDITOR
-	if (!TextFormat.GetSourceText().IdenticalTo(FormatText))
-#endif
+	// IdenticalTo is a pointer comparison, so this only recompiles when the format is edited or the culture changes
+	bool bUpdateAllArguments = UpdateType != EMDFastBindingUpdateType::IfUpdatesNeeded && UpdateType != EMDFastBindingUpdateType::Always;
+	if (!bIsFormatCompiled || !CompiledFormatText.IdenticalTo(FormatText))
 	{
-		TextFormat = FormatText;
+		// Compiling resets the arguments, so they all need to be filled in again whether or not they changed
+		CompileFormat();
+		bUpdateAllArguments = true;
 	}
 
-	bool bNeedsUpdate = false;
-	for (const FName& Arg : Arguments)
+	bool bNeedsUpdate = bUpdateAllArguments;
+
+	for (int32 i = 0; i < Arguments.Num(); ++i)
 	{
+		const int32 ItemIndex = ArgumentItemIndices[i];
+		if (ItemIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
 		bool bDidUpdate = false;
-		const TTuple<const FProperty*, void*> ArgValue = GetBindingItemValue(SourceObject, Arg, bDidUpdate);
-		if (bDidUpdate || UpdateType != EMDFastBindingUpdateType::IfUpdatesNeeded)
+		const TTuple<const FProperty*, void*> ArgValue = GetBindingItemValue(SourceObject, ItemIndex, bDidUpdate);
+		if (bDidUpdate || bUpdateAllArguments)
 		{
 			bNeedsUpdate = true;
-			if (ArgValue.Value != nullptr)
-			{
-				FText ArgText;
-				FMDFastBindingModule::SetPropertyDirectly(GetOutputProperty(), &ArgText, ArgValue.Key, ArgValue.Value);
-
-				Args.FindOrAdd(Arg.ToString()) = ArgText;
-			}
-			else
-			{
-				Args.FindOrAdd(Arg.ToString()) = FText::GetEmpty();
-			}
+			UpdateArgument(i, ArgValue.Key, ArgValue.Value);
 		}
 	}
 
-	if (bNeedsUpdate || UpdateType != EMDFastBindingUpdateType::IfUpdatesNeeded)
+	if (bNeedsUpdate)
 	{
+		// Formatting keeps the text's history, so the output can be compared and re-rendered like any other formatted text
 		OutputValue = FText::Format(TextFormat, Args);
 	}
 
 	return TTuple<const FProperty*, void*>{ GetOutputProperty(), &OutputValue };
 }
 
+void UMDFastBindingValue_FormatText::TerminateValue_Internal(UObject* SourceObject)
+{
+	Super::TerminateValue_Internal(SourceObject);
+
+	if (CultureChangedHandle.IsValid())
+	{
+		FInternationalization::Get().OnCultureChanged().Remove(CultureChangedHandle);
+		CultureChangedHandle.Reset();
+	}
+}
+
+void UMDFastBindingValue_FormatText::CompileFormat()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	TextFormat = FormatText;
+	CompiledFormatText = FormatText;
+	bIsFormatCompiled = true;
+
+	Args.Reset();
+	ArgumentItemIndices.Reset(Arguments.Num());
+	for (const FName& Arg : Arguments)
+	{
+		ArgumentItemIndices.Add(BindingItems.IndexOfByKey(Arg));
+		Args.Add(Arg.ToString(), FText::GetEmpty());
+	}
+
+	// Only grab the slots once all the keys are added so the map won't reallocate under us
+	ArgumentSlots.Reset(Arguments.Num());
+	for (const FName& Arg : Arguments)
+	{
+		ArgumentSlots.Add(Args.Find(Arg.ToString()));
+	}
+
+	// Only argument modifiers (eg. {Count}|plural(...)) need to see numbers, anything escaped with ` can't start one
+	bHasArgumentModifiers = false;
+
+	const FString& FormatString = FormatText.ToString();
+	bool bIsEscaping = false;
+	for (int32 i = 0; i < FormatString.Len() && !bHasArgumentModifiers; ++i)
+	{
+		const TCHAR Char = FormatString[i];
+		if (Char == TEXT('`') && !bIsEscaping)
+		{
+			bIsEscaping = true;
+			continue;
+		}
+
+		bHasArgumentModifiers = !bIsEscaping && Char == TEXT('}') && i + 1 < FormatString.Len() && FormatString[i + 1] == TEXT('|');
+		bIsEscaping = false;
+	}
+}
+
+void UMDFastBindingValue_FormatText::UpdateArgument(int32 ArgumentIndex, const FProperty* ArgProp, const void* ArgValuePtr)
+{
+	FFormatArgumentValue& Slot = *ArgumentSlots[ArgumentIndex];
+	if (ArgProp == nullptr || ArgValuePtr == nullptr)
+	{
+		Slot = FText::GetEmpty();
+		return;
+	}
+
+	if (const FTextProperty* ArgTextProp = CastField<const FTextProperty>(ArgProp))
+	{
+		Slot = ArgTextProp->GetPropertyValue(ArgValuePtr);
+	}
+	else if (const FNumericProperty* NumericProp = CastField<const FNumericProperty>(ArgProp))
+	{
+		if (!bHasArgumentModifiers)
+		{
+			// Formats the same as FText::Format would, but recurring values come from the shared cache
+			Slot = FMDFastBindingPropertySetter_Text::NumericToText(*NumericProp, ArgValuePtr);
+		}
+		else if (NumericProp->IsFloatingPoint())
+		{
+			// Keep numbers as numbers so plural and ordinal modifiers work
+			Slot = FFormatArgumentValue(NumericProp->GetFloatingPointPropertyValue(ArgValuePtr));
+		}
+		else if (NumericProp->IsA<FUInt64Property>())
+		{
+			Slot = FFormatArgumentValue(NumericProp->GetUnsignedIntPropertyValue(ArgValuePtr));
+		}
+		else
+		{
+			Slot = FFormatArgumentValue(NumericProp->GetSignedIntPropertyValue(ArgValuePtr));
+		}
+	}
+	else if (FMDFastBindingPropertySetter_Text::CanConvertToText(*ArgProp))
+	{
+		// Strings and names are converted here rather than by a registered setter, which would change what every text pin accepts
+		Slot = FMDFastBindingPropertySetter_Text::ToText(*ArgProp, ArgValuePtr);
+	}
+	else
+	{
+		FText ArgText;
+		FMDFastBindingModule::SetPropertyDirectly(GetOutputProperty(), &ArgText, ArgProp, ArgValuePtr);
+		Slot = MoveTemp(ArgText);
+	}
+}
+
+void UMDFastBindingValue_FormatText::OnCultureChanged()
+{
+	// The localized pattern and any numbers formatted into it need to be rebuilt
+	bIsFormatCompiled = false;
+	MarkObjectDirty();
+}
+
 const FProperty* UMDFastBindingValue_FormatText::GetOutputProperty()
 {
 	if (TextProp == nullptr)
@@ -58,9 +190,18 @@ FText UMDFastBindingValue_FormatText::GetDisplayName()
 }
 #endif
 
+#if WITH_EDITOR
+bool UMDFastBindingValue_FormatText::CanBindingItemAcceptValue(const FMDFastBindingItem& BindingItem, const FProperty* ValueProp) const
+{
+	// Every binding item is an argument, which converts numbers, strings and names itself
+	return (ValueProp != nullptr && FMDFastBindingPropertySetter_Text::CanConvertToText(*ValueProp)) || Super::CanBindingItemAcceptValue(BindingItem, ValueProp);
+}
+#endif
+
 void UMDFastBindingValue_FormatText::SetupBindingItems()
 {
 	Arguments.Empty();
+	bIsFormatCompiled = false;
 
 	FString Argument;
 	Argument.Reserve(FormatText.ToString().Len());
@@ -82,7 +223,8 @@ void UMDFastBindingValue_FormatText::SetupBindingItems()
 		else if (bIsParsingArgument && Char == '}' && !bIsEscaping)
 		{
 			bIsParsingArgument = false;
-			Arguments.Emplace(MoveTemp(Argument));
+			// Repeated arguments share a pin and a slot
+			Arguments.AddUnique(FName(*Argument));
 			Argument.Empty(FormatText.ToString().Len());
 		}
 		else if (bIsParsingArgument)
@@ -0,0 +1,111 @@
+#include "BindingValues/MDFastBindingValue_Gate.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingValue_Gate"
+
+namespace MDFastBindingValue_Gate_Private
+{
+	const FName ConditionName = TEXT("Condition");
+	const FName ValueName = TEXT("Value");
+	const FName ClosedValueName = TEXT("Closed Value");
+}
+
+const FProperty* UMDFastBindingValue_Gate::GetOutputProperty()
+{
+	return ResolveOutputProperty();
+}
+
+void UMDFastBindingValue_Gate::InitializeValue_Internal(UObject* SourceObject)
+{
+	Super::InitializeValue_Internal(SourceObject);
+
+	LastValue = {};
+	bIsOpen = false;
+}
+
+TTuple<const FProperty*, void*> UMDFastBindingValue_Gate::GetValue_Internal(UObject* SourceObject)
+{
+	bool bDidUpdate = false;
+	const TTuple<const FProperty*, void*> ConditionValue = GetBindingItemValue(SourceObject, MDFastBindingValue_Gate_Private::ConditionName, bDidUpdate);
+	const FBoolProperty* BoolProp = CastField<const FBoolProperty>(ConditionValue.Key);
+	bIsOpen = BoolProp != nullptr && ConditionValue.Value != nullptr && BoolProp->GetPropertyValue(ConditionValue.Value);
+
+	if (bIsOpen)
+	{
+		LastValue = GetBindingItemValue(SourceObject, MDFastBindingValue_Gate_Private::ValueName, bDidUpdate);
+		return LastValue;
+	}
+
+	if (bHoldLastValue && LastValue.Value != nullptr)
+	{
+		return LastValue;
+	}
+
+	return GetBindingItemValue(SourceObject, MDFastBindingValue_Gate_Private::ClosedValueName, bDidUpdate);
+}
+
+bool UMDFastBindingValue_Gate::IsBindingItemRelevantToUpdate(int32 ItemIndex) const
+{
+	const FName& ItemName = BindingItems[ItemIndex].ItemName;
+	if (ItemName == MDFastBindingValue_Gate_Private::ValueName)
+	{
+		return bIsOpen;
+	}
+
+	if (ItemName == MDFastBindingValue_Gate_Private::ClosedValueName)
+	{
+		return !bIsOpen && !(bHoldLastValue && LastValue.Value != nullptr);
+	}
+
+	return true;
+}
+
+void UMDFastBindingValue_Gate::SetupBindingItems()
+{
+	Super::SetupBindingItems();
+
+	EnsureBindingItemExists(MDFastBindingValue_Gate_Private::ConditionName
+		, GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Gate, ConditionProperty))
+		, LOCTEXT("ConditionToolTip", "While true, Value is updated and passed through"));
+
+	const FProperty* OutputProp = ResolveOutputProperty();
+	EnsureBindingItemExists(MDFastBindingValue_Gate_Private::ValueName, OutputProp
+		, LOCTEXT("ValueToolTip", "The value to output while the gate is open, it isn't updated while the gate is closed"));
+	EnsureBindingItemExists(MDFastBindingValue_Gate_Private::ClosedValueName, OutputProp
+		, LOCTEXT("ClosedValueToolTip", "The value to output while the gate is closed and there's no last value to hold")
+		, true);
+}
+
+const FProperty* UMDFastBindingValue_Gate::ResolveOutputProperty()
+{
+#if !WITH_EDITOR
+	if (ResolvedOutputProperty.IsValid())
+	{
+		return ResolvedOutputProperty.Get();
+	}
+#endif
+
+	if (const FMDFastBindingItem* OwningItem = GetOwningBindingItem())
+	{
+		if (const FProperty* OwningItemProp = OwningItem->ItemProperty.Get())
+		{
+			ResolvedOutputProperty = OwningItemProp;
+			return OwningItemProp;
+		}
+	}
+
+	if (const FProperty* ValueProp = GetBindingItemValueProperty(MDFastBindingValue_Gate_Private::ValueName))
+	{
+		ResolvedOutputProperty = ValueProp;
+		return ValueProp;
+	}
+
+	if (const FProperty* ClosedValueProp = GetBindingItemValueProperty(MDFastBindingValue_Gate_Private::ClosedValueName))
+	{
+		ResolvedOutputProperty = ClosedValueProp;
+		return ClosedValueProp;
+	}
+
+	return nullptr;
+}
+
+#undef LOCTEXT_NAMESPACE
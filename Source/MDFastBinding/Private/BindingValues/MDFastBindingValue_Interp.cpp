@@ -0,0 +1,134 @@
+#include "BindingValues/MDFastBindingValue_Interp.h"
+
+#include "MDFastBinding.h"
+#include "Engine/World.h"
+#include "Misc/App.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingValue_Interp"
+
+namespace MDFastBindingValue_Interp_Private
+{
+	const FName TargetName = TEXT("Target");
+}
+
+const FProperty* UMDFastBindingValue_Interp::GetOutputProperty()
+{
+	return GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Interp, OutputValue));
+}
+
+#if WITH_EDITORONLY_DATA
+FText UMDFastBindingValue_Interp::GetDisplayName()
+{
+	if (const UEnum* ModeEnum = StaticEnum<EMDFastBindingInterpMode>())
+	{
+		return ModeEnum->GetDisplayNameTextByValue(static_cast<int64>(InterpMode));
+	}
+
+	return Super::GetDisplayName();
+}
+#endif
+
+bool UMDFastBindingValue_Interp::CheckNeedsUpdate() const
+{
+	// While moving we need to update every frame, once at rest we only need to update if the target changes
+	return !bIsAtTarget || Super::CheckNeedsUpdate();
+}
+
+void UMDFastBindingValue_Interp::InitializeValue_Internal(UObject* SourceObject)
+{
+	Super::InitializeValue_Internal(SourceObject);
+
+	OutputValue = 0.0;
+	Velocity = 0.0;
+	bIsAtTarget = false;
+	bHasTarget = false;
+}
+
+TTuple<const FProperty*, void*> UMDFastBindingValue_Interp::GetValue_Internal(UObject* SourceObject)
+{
+	bool bDidUpdate = false;
+	const TTuple<const FProperty*, void*> Target = GetBindingItemValue(SourceObject, MDFastBindingValue_Interp_Private::TargetName, bDidUpdate);
+	if (Target.Key == nullptr || Target.Value == nullptr)
+	{
+		return TTuple<const FProperty*, void*>{ GetOutputProperty(), &OutputValue };
+	}
+
+	const FProperty* TargetProp = GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Interp, TargetValue));
+	if (Target.Key->SameType(TargetProp))
+	{
+		TargetValue = *static_cast<const double*>(Target.Value);
+	}
+	else
+	{
+		FMDFastBindingModule::SetPropertyDirectly(TargetProp, &TargetValue, Target.Key, Target.Value);
+	}
+
+	if (!bHasTarget)
+	{
+		bHasTarget = true;
+		if (bSnapToInitialTarget)
+		{
+			OutputValue = TargetValue;
+		}
+	}
+
+	const UWorld* World = SourceObject != nullptr ? SourceObject->GetWorld() : nullptr;
+	Step(World != nullptr ? World->GetDeltaSeconds() : static_cast<float>(FApp::GetDeltaTime()));
+
+	return TTuple<const FProperty*, void*>{ GetOutputProperty(), &OutputValue };
+}
+
+void UMDFastBindingValue_Interp::Step(float DeltaTime)
+{
+	const double Delta = TargetValue - OutputValue;
+	if (FMath::Abs(Delta) <= Tolerance && FMath::Abs(Velocity) <= Tolerance)
+	{
+		OutputValue = TargetValue;
+		Velocity = 0.0;
+		bIsAtTarget = true;
+		return;
+	}
+
+	bIsAtTarget = false;
+
+	switch (InterpMode)
+	{
+	case EMDFastBindingInterpMode::InterpTo:
+		OutputValue = FMath::FInterpTo(OutputValue, TargetValue, static_cast<double>(DeltaTime), static_cast<double>(Speed));
+		break;
+	case EMDFastBindingInterpMode::Spring:
+	{
+		// Implicit Euler so large frame hitches can't make the spring explode
+		const double Stiffness = SpringStiffness;
+		const double Damping = 2.0 * SpringDampingRatio * FMath::Sqrt(Stiffness);
+		const double Dt = DeltaTime;
+		Velocity = (Velocity + Dt * Stiffness * Delta) / (1.0 + Dt * Damping + Dt * Dt * Stiffness);
+		OutputValue += Dt * Velocity;
+		break;
+	}
+	case EMDFastBindingInterpMode::ConstantSpeed:
+		// Match FInterpTo's behaviour of snapping with no speed rather than never arriving
+		OutputValue = Speed > 0.f
+			? FMath::FInterpConstantTo(OutputValue, TargetValue, static_cast<double>(DeltaTime), static_cast<double>(Speed))
+			: TargetValue;
+		break;
+	}
+
+	if (FMath::Abs(TargetValue - OutputValue) <= Tolerance && FMath::Abs(Velocity) <= Tolerance)
+	{
+		OutputValue = TargetValue;
+		Velocity = 0.0;
+		bIsAtTarget = true;
+	}
+}
+
+void UMDFastBindingValue_Interp::SetupBindingItems()
+{
+	Super::SetupBindingItems();
+
+	EnsureBindingItemExists(MDFastBindingValue_Interp_Private::TargetName
+		, GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Interp, TargetValue))
+		, LOCTEXT("TargetToolTip", "The value the output moves towards"));
+}
+
+#undef LOCTEXT_NAMESPACE
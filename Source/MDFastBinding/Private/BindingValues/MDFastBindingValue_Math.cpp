@@ -0,0 +1,398 @@
+#include "BindingValues/MDFastBindingValue_Math.h"
+
+#include "MDFastBinding.h"
+#include "Math/VectorRegister.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingValue_Math"
+
+namespace MDFastBindingValue_Math_Private
+{
+	const FName AName = TEXT("A");
+	const FName BName = TEXT("B");
+	const FName ValueName = TEXT("Value");
+	const FName MinName = TEXT("Min");
+	const FName MaxName = TEXT("Max");
+	const FName AlphaName = TEXT("Alpha");
+	const FName InMinName = TEXT("In Min");
+	const FName InMaxName = TEXT("In Max");
+	const FName OutMinName = TEXT("Out Min");
+	const FName OutMaxName = TEXT("Out Max");
+
+	const FName BinaryOperands[] = { AName, BName };
+	const FName ClampOperands[] = { ValueName, MinName, MaxName };
+	const FName LerpOperands[] = { AName, BName };
+	const FName MapRangeOperands[] = { ValueName, InMinName, InMaxName, OutMinName, OutMaxName };
+	const FName NormalizeOperands[] = { ValueName };
+
+	constexpr int32 MaxOperands = UE_ARRAY_COUNT(MapRangeOperands);
+
+	// Scalar kernels, the Vector and Linear Color specializations below work on every component at once
+	template<typename T>
+	struct TMathKernel
+	{
+		static T Zero() { return T(0); }
+		static T Add(const T& A, const T& B) { return A + B; }
+		static T Subtract(const T& A, const T& B) { return A - B; }
+		static T Multiply(const T& A, const T& B) { return A * B; }
+		static T Divide(const T& A, const T& B) { return B != T(0) ? A / B : T(0); }
+		static T Min(const T& A, const T& B) { return FMath::Min(A, B); }
+		static T Max(const T& A, const T& B) { return FMath::Max(A, B); }
+		static T Clamp(const T& Value, const T& Min, const T& Max) { return FMath::Clamp(Value, Min, Max); }
+		static T Lerp(const T& A, const T& B, double Alpha) { return static_cast<T>(A + Alpha * (B - A)); }
+		// A normalized 1D vector is its sign
+		static T Normalize(const T& Value) { return static_cast<T>(FMath::Sign(Value)); }
+
+		static T MapRange(const T& Value, const T& InMin, const T& InMax, const T& OutMin, const T& OutMax)
+		{
+			const T InRange = InMax - InMin;
+			return InRange != T(0) ? OutMin + (Value - InMin) * (OutMax - OutMin) / InRange : OutMin;
+		}
+
+		static bool Less(const T& A, const T& B) { return A < B; }
+		static bool LessOrEqual(const T& A, const T& B) { return A <= B; }
+		static bool Greater(const T& A, const T& B) { return A > B; }
+		static bool GreaterOrEqual(const T& A, const T& B) { return A >= B; }
+	};
+
+	template<>
+	struct TMathKernel<FVector>
+	{
+		static bool HasZeroComponent(const FVector& V) { return V.X == 0.0 || V.Y == 0.0 || V.Z == 0.0; }
+
+		static FVector Zero() { return FVector::ZeroVector; }
+		static FVector Add(const FVector& A, const FVector& B) { return A + B; }
+		static FVector Subtract(const FVector& A, const FVector& B) { return A - B; }
+		static FVector Multiply(const FVector& A, const FVector& B) { return A * B; }
+		static FVector Divide(const FVector& A, const FVector& B) { return HasZeroComponent(B) ? FVector::ZeroVector : A / B; }
+		static FVector Min(const FVector& A, const FVector& B) { return A.ComponentMin(B); }
+		static FVector Max(const FVector& A, const FVector& B) { return A.ComponentMax(B); }
+		static FVector Clamp(const FVector& Value, const FVector& Min, const FVector& Max) { return Value.ComponentMax(Min).ComponentMin(Max); }
+		static FVector Lerp(const FVector& A, const FVector& B, double Alpha) { return A + Alpha * (B - A); }
+		static FVector Normalize(const FVector& Value) { return Value.GetSafeNormal(); }
+
+		static FVector MapRange(const FVector& Value, const FVector& InMin, const FVector& InMax, const FVector& OutMin, const FVector& OutMax)
+		{
+			const FVector InRange = InMax - InMin;
+			return HasZeroComponent(InRange) ? OutMin : OutMin + (Value - InMin) * (OutMax - OutMin) / InRange;
+		}
+
+		// Vectors are ordered by their length
+		static bool Less(const FVector& A, const FVector& B) { return A.SizeSquared() < B.SizeSquared(); }
+		static bool LessOrEqual(const FVector& A, const FVector& B) { return A.SizeSquared() <= B.SizeSquared(); }
+		static bool Greater(const FVector& A, const FVector& B) { return A.SizeSquared() > B.SizeSquared(); }
+		static bool GreaterOrEqual(const FVector& A, const FVector& B) { return A.SizeSquared() >= B.SizeSquared(); }
+	};
+
+	template<>
+	struct TMathKernel<FLinearColor>
+	{
+		static FLinearColor Zero() { return FLinearColor(0.f, 0.f, 0.f, 0.f); }
+
+		static VectorRegister4Float Load(const FLinearColor& Color) { return VectorLoad(&Color.R); }
+
+		static FLinearColor Store(const VectorRegister4Float& Register)
+		{
+			FLinearColor Result;
+			VectorStore(Register, &Result.R);
+			return Result;
+		}
+
+		static bool HasZeroComponent(const VectorRegister4Float& Register) { return VectorMaskBits(VectorCompareEQ(Register, VectorZeroFloat())) != 0; }
+
+		static FLinearColor Add(const FLinearColor& A, const FLinearColor& B) { return Store(VectorAdd(Load(A), Load(B))); }
+		static FLinearColor Subtract(const FLinearColor& A, const FLinearColor& B) { return Store(VectorSubtract(Load(A), Load(B))); }
+		static FLinearColor Multiply(const FLinearColor& A, const FLinearColor& B) { return Store(VectorMultiply(Load(A), Load(B))); }
+		static FLinearColor Min(const FLinearColor& A, const FLinearColor& B) { return Store(VectorMin(Load(A), Load(B))); }
+		static FLinearColor Max(const FLinearColor& A, const FLinearColor& B) { return Store(VectorMax(Load(A), Load(B))); }
+
+		static FLinearColor Divide(const FLinearColor& A, const FLinearColor& B)
+		{
+			const VectorRegister4Float Divisor = Load(B);
+			return HasZeroComponent(Divisor) ? Zero() : Store(VectorDivide(Load(A), Divisor));
+		}
+
+		static FLinearColor Clamp(const FLinearColor& Value, const FLinearColor& Min, const FLinearColor& Max)
+		{
+			return Store(VectorMin(VectorMax(Load(Value), Load(Min)), Load(Max)));
+		}
+
+		static FLinearColor Lerp(const FLinearColor& A, const FLinearColor& B, double Alpha)
+		{
+			const VectorRegister4Float ARegister = Load(A);
+			return Store(VectorMultiplyAdd(VectorSubtract(Load(B), ARegister), VectorSetFloat1(static_cast<float>(Alpha)), ARegister));
+		}
+
+		static FLinearColor MapRange(const FLinearColor& Value, const FLinearColor& InMin, const FLinearColor& InMax, const FLinearColor& OutMin, const FLinearColor& OutMax)
+		{
+			const VectorRegister4Float InMinRegister = Load(InMin);
+			const VectorRegister4Float OutMinRegister = Load(OutMin);
+			const VectorRegister4Float InRange = VectorSubtract(Load(InMax), InMinRegister);
+			if (HasZeroComponent(InRange))
+			{
+				return OutMin;
+			}
+
+			const VectorRegister4Float Scale = VectorDivide(VectorSubtract(Load(OutMax), OutMinRegister), InRange);
+			return Store(VectorMultiplyAdd(VectorSubtract(Load(Value), InMinRegister), Scale, OutMinRegister));
+		}
+
+		// Scales the color channels so the brightest is 1, alpha is left alone
+		static FLinearColor Normalize(const FLinearColor& Value)
+		{
+			const float MaxChannel = FMath::Max3(Value.R, Value.G, Value.B);
+			if (MaxChannel <= 0.f)
+			{
+				return FLinearColor(0.f, 0.f, 0.f, Value.A);
+			}
+
+			return FLinearColor(Value.R / MaxChannel, Value.G / MaxChannel, Value.B / MaxChannel, Value.A);
+		}
+
+		// Colors are ordered by their length as a 4D vector, the same as Vectors
+		static float SizeSquared(const FLinearColor& Color) { return Color.R * Color.R + Color.G * Color.G + Color.B * Color.B + Color.A * Color.A; }
+
+		static bool Less(const FLinearColor& A, const FLinearColor& B) { return SizeSquared(A) < SizeSquared(B); }
+		static bool LessOrEqual(const FLinearColor& A, const FLinearColor& B) { return SizeSquared(A) <= SizeSquared(B); }
+		static bool Greater(const FLinearColor& A, const FLinearColor& B) { return SizeSquared(A) > SizeSquared(B); }
+		static bool GreaterOrEqual(const FLinearColor& A, const FLinearColor& B) { return SizeSquared(A) >= SizeSquared(B); }
+	};
+}
+
+const FProperty* UMDFastBindingValue_Math::GetOutputProperty()
+{
+	if (OutputProp == nullptr)
+	{
+		OutputProp = IsComparison()
+			? GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Math, BoolValue))
+			: GetValueTypeProperty();
+	}
+
+	return OutputProp;
+}
+
+TTuple<const FProperty*, void*> UMDFastBindingValue_Math::GetValue_Internal(UObject* SourceObject)
+{
+	void* OutputPtr = nullptr;
+	switch (ValueType)
+	{
+	case EMDFastBindingMathType::Integer:
+		Evaluate(SourceObject, IntValue);
+		OutputPtr = &IntValue;
+		break;
+	case EMDFastBindingMathType::Float:
+		Evaluate(SourceObject, FloatValue);
+		OutputPtr = &FloatValue;
+		break;
+	case EMDFastBindingMathType::Double:
+		Evaluate(SourceObject, DoubleValue);
+		OutputPtr = &DoubleValue;
+		break;
+	case EMDFastBindingMathType::Vector:
+		Evaluate(SourceObject, VectorValue);
+		OutputPtr = &VectorValue;
+		break;
+	case EMDFastBindingMathType::LinearColor:
+		Evaluate(SourceObject, LinearColorValue);
+		OutputPtr = &LinearColorValue;
+		break;
+	}
+
+	if (IsComparison())
+	{
+		OutputPtr = &BoolValue;
+	}
+
+	return TTuple<const FProperty*, void*>{ GetOutputProperty(), OutputPtr };
+}
+
+template<typename T>
+bool UMDFastBindingValue_Math::ReadOperand(UObject* SourceObject, const FName& ItemName, const FProperty* OperandProp, T& OutValue)
+{
+	bool bDidUpdate = false;
+	const TTuple<const FProperty*, void*> Value = GetBindingItemValue(SourceObject, ItemName, bDidUpdate);
+	if (Value.Key != nullptr && Value.Value != nullptr)
+	{
+		if (Value.Key->SameType(OperandProp))
+		{
+			OutValue = *static_cast<const T*>(Value.Value);
+		}
+		else
+		{
+			FMDFastBindingModule::SetPropertyDirectly(OperandProp, &OutValue, Value.Key, Value.Value);
+		}
+	}
+
+	return bDidUpdate;
+}
+
+template<typename T>
+void UMDFastBindingValue_Math::Evaluate(UObject* SourceObject, T& OutValue)
+{
+	using namespace MDFastBindingValue_Math_Private;
+	using FKernel = TMathKernel<T>;
+
+	const FProperty* OperandProp = GetValueTypeProperty();
+	const TConstArrayView<FName> OperandNames = GetOperandNames();
+
+	T Operands[MaxOperands];
+	bool bDidUpdate = UpdateType != EMDFastBindingUpdateType::IfUpdatesNeeded;
+	for (int32 i = 0; i < OperandNames.Num(); ++i)
+	{
+		Operands[i] = FKernel::Zero();
+		bDidUpdate |= ReadOperand(SourceObject, OperandNames[i], OperandProp, Operands[i]);
+	}
+
+	double Alpha = 0.0;
+	if (Operation == EMDFastBindingMathOperation::Lerp)
+	{
+		bDidUpdate |= ReadOperand(SourceObject, AlphaName, GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Math, AlphaValue)), Alpha);
+	}
+
+	if (!bDidUpdate)
+	{
+		return;
+	}
+
+	switch (Operation)
+	{
+	case EMDFastBindingMathOperation::Add:
+		OutValue = FKernel::Add(Operands[0], Operands[1]);
+		break;
+	case EMDFastBindingMathOperation::Subtract:
+		OutValue = FKernel::Subtract(Operands[0], Operands[1]);
+		break;
+	case EMDFastBindingMathOperation::Multiply:
+		OutValue = FKernel::Multiply(Operands[0], Operands[1]);
+		break;
+	case EMDFastBindingMathOperation::Divide:
+		OutValue = FKernel::Divide(Operands[0], Operands[1]);
+		break;
+	case EMDFastBindingMathOperation::Min:
+		OutValue = FKernel::Min(Operands[0], Operands[1]);
+		break;
+	case EMDFastBindingMathOperation::Max:
+		OutValue = FKernel::Max(Operands[0], Operands[1]);
+		break;
+	case EMDFastBindingMathOperation::Clamp:
+		OutValue = FKernel::Clamp(Operands[0], Operands[1], Operands[2]);
+		break;
+	case EMDFastBindingMathOperation::Lerp:
+		OutValue = FKernel::Lerp(Operands[0], Operands[1], Alpha);
+		break;
+	case EMDFastBindingMathOperation::MapRange:
+		OutValue = FKernel::MapRange(Operands[0], Operands[1], Operands[2], Operands[3], Operands[4]);
+		break;
+	case EMDFastBindingMathOperation::Normalize:
+		OutValue = FKernel::Normalize(Operands[0]);
+		break;
+	case EMDFastBindingMathOperation::Less:
+		BoolValue = FKernel::Less(Operands[0], Operands[1]);
+		break;
+	case EMDFastBindingMathOperation::LessOrEqual:
+		BoolValue = FKernel::LessOrEqual(Operands[0], Operands[1]);
+		break;
+	case EMDFastBindingMathOperation::Greater:
+		BoolValue = FKernel::Greater(Operands[0], Operands[1]);
+		break;
+	case EMDFastBindingMathOperation::GreaterOrEqual:
+		BoolValue = FKernel::GreaterOrEqual(Operands[0], Operands[1]);
+		break;
+	case EMDFastBindingMathOperation::Equal:
+		BoolValue = Operands[0] == Operands[1];
+		break;
+	case EMDFastBindingMathOperation::NotEqual:
+		BoolValue = Operands[0] != Operands[1];
+		break;
+	}
+}
+
+bool UMDFastBindingValue_Math::IsComparison() const
+{
+	return Operation >= EMDFastBindingMathOperation::Less;
+}
+
+const FProperty* UMDFastBindingValue_Math::GetValueTypeProperty() const
+{
+	switch (ValueType)
+	{
+	case EMDFastBindingMathType::Integer:
+		return GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Math, IntValue));
+	case EMDFastBindingMathType::Float:
+		return GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Math, FloatValue));
+	case EMDFastBindingMathType::Double:
+		return GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Math, DoubleValue));
+	case EMDFastBindingMathType::Vector:
+		return GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Math, VectorValue));
+	case EMDFastBindingMathType::LinearColor:
+		return GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Math, LinearColorValue));
+	}
+
+	return nullptr;
+}
+
+TConstArrayView<FName> UMDFastBindingValue_Math::GetOperandNames() const
+{
+	using namespace MDFastBindingValue_Math_Private;
+
+	switch (Operation)
+	{
+	case EMDFastBindingMathOperation::Clamp:
+		return ClampOperands;
+	case EMDFastBindingMathOperation::Lerp:
+		return LerpOperands;
+	case EMDFastBindingMathOperation::MapRange:
+		return MapRangeOperands;
+	case EMDFastBindingMathOperation::Normalize:
+		return NormalizeOperands;
+	default:
+		return BinaryOperands;
+	}
+}
+
+void UMDFastBindingValue_Math::SetupBindingItems()
+{
+	Super::SetupBindingItems();
+
+	// Operation or ValueType may have changed
+	OutputProp = nullptr;
+
+	const TConstArrayView<FName> OperandNames = GetOperandNames();
+	const bool bHasAlpha = Operation == EMDFastBindingMathOperation::Lerp;
+	for (int32 i = BindingItems.Num() - 1; i >= 0; --i)
+	{
+		const FName& ItemName = BindingItems[i].ItemName;
+		if (!OperandNames.Contains(ItemName) && !(bHasAlpha && ItemName == MDFastBindingValue_Math_Private::AlphaName))
+		{
+#if WITH_EDITORONLY_DATA
+			if (BindingItems[i].Value != nullptr)
+			{
+				OrphanBindingItem(BindingItems[i].Value);
+			}
+#endif
+			BindingItems.RemoveAt(i);
+		}
+	}
+
+	const FProperty* OperandProp = GetValueTypeProperty();
+	for (const FName& OperandName : OperandNames)
+	{
+		EnsureBindingItemExists(OperandName, OperandProp, FText::GetEmpty());
+	}
+
+	if (bHasAlpha)
+	{
+		EnsureBindingItemExists(MDFastBindingValue_Math_Private::AlphaName
+			, GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Math, AlphaValue))
+			, LOCTEXT("AlphaToolTip", "0 returns A, 1 returns B"));
+	}
+}
+
+#if WITH_EDITORONLY_DATA
+FText UMDFastBindingValue_Math::GetDisplayName()
+{
+	static const FText Format = LOCTEXT("DisplayNameFormat", "{0} ({1})");
+	return FText::Format(Format, UEnum::GetDisplayValueAsText(Operation), UEnum::GetDisplayValueAsText(ValueType));
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
@@ -1,7 +1,11 @@
 ﻿
 #include "BindingValues/MDFastBindingValue_Select.h"
 
+#include "MDFastBinding.h"
 #include "MDFastBindingHelpers.h"
+#include "MDFastBindingInstance.h"
+#include "Engine/StreamableManager.h"
+#include "Util/MDFastBindingAssetPrefetcher.h"
 
 #define LOCTEXT_NAMESPACE "MDFastBindingValue_Select"
 
@@ -16,6 +20,13 @@ namespace MDFastBindingValue_Select_Private
 	const FName TrueItemName = TEXT("True");
 }
 
+void UMDFastBindingValue_Select::BeginDestroy()
+{
+	Super::BeginDestroy();
+
+	FreeLookup();
+}
+
 const FProperty* UMDFastBindingValue_Select::GetOutputProperty()
 {
 	return ResolveOutputProperty();
@@ -27,8 +38,24 @@ bool UMDFastBindingValue_Select::HasUserExtendablePinList() const
 	return SelectValueProp != nullptr && !(SelectValueProp->IsA<FBoolProperty>() || SelectValueProp->IsA<FEnumProperty>());
 }
 
+void UMDFastBindingValue_Select::InitializeValue_Internal(UObject* SourceObject)
+{
+	Super::InitializeValue_Internal(SourceObject);
+
+	// Wait for the first update to gather the results since their inputs may not be ready during initialization
+	bNeedsPrefetch = PrefetchMode != EMDFastBindingSelectPrefetchMode::None;
+}
+
 TTuple<const FProperty*, void*> UMDFastBindingValue_Select::GetValue_Internal(UObject* SourceObject)
 {
+	if (bNeedsPrefetch)
+	{
+		bNeedsPrefetch = false;
+		RequestPrefetch(SourceObject);
+	}
+
+	SelectedItemIndex = INDEX_NONE;
+
 	bool bDidUpdate = false;
 	TTuple<const FProperty*, void*> InputValue = GetBindingItemValue(SourceObject, MDFastBindingValue_Select_Private::SelectValueInputName, bDidUpdate);
 	if (InputValue.Key == nullptr || InputValue.Value == nullptr)
@@ -41,11 +68,11 @@ TTuple<const FProperty*, void*> UMDFastBindingValue_Select::GetValue_Internal(UO
 		static const bool TrueValue = true;
 		if (BoolProp->Identical(&TrueValue, InputValue.Value, 0))
 		{
-			return GetBindingItemValue(SourceObject, MDFastBindingValue_Select_Private::TrueItemName, bDidUpdate);
+			return GetSelectedValue(SourceObject, MDFastBindingValue_Select_Private::TrueItemName);
 		}
 		else
 		{
-			return GetBindingItemValue(SourceObject, MDFastBindingValue_Select_Private::FalseItemName, bDidUpdate);
+			return GetSelectedValue(SourceObject, MDFastBindingValue_Select_Private::FalseItemName);
 		}
 	}
 	else if (const FEnumProperty* EnumProp = CastField<const FEnumProperty>(InputValue.Key))
@@ -55,33 +82,189 @@ TTuple<const FProperty*, void*> UMDFastBindingValue_Select::GetValue_Internal(UO
 			const int64 Value = UnderlyingProp->GetSignedIntPropertyValue(InputValue.Value);
 			if (const FName* PinName = EnumValueToPinNameMap.Find(Value))
 			{
-				return GetBindingItemValue(SourceObject, *PinName, bDidUpdate);
+				return GetSelectedValue(SourceObject, *PinName);
 			}
 		}
 	}
 	else
 	{
-		for (FMDFastBindingItem& BindingItem : BindingItems)
+		const int32 MatchingItemIndex = FindMatchingMapping(SourceObject, InputValue);
+		if (BindingItems.IsValidIndex(MatchingItemIndex))
 		{
-			if (BindingItem.ExtendablePinListIndex != INDEX_NONE && BindingItem.ExtendablePinListNameBase == MDFastBindingValue_Select_Private::FromValueItemName)
+			const FName& ResultValueName = FindOrCreateExtendableItemName(MDFastBindingValue_Select_Private::ToValueItemName, BindingItems[MatchingItemIndex].ExtendablePinListIndex);
+			return GetSelectedValue(SourceObject, ResultValueName);
+		}
+
+		return GetSelectedValue(SourceObject, MDFastBindingValue_Select_Private::FallbackResultInputName);
+	}
+
+	return {};
+}
+
+TTuple<const FProperty*, void*> UMDFastBindingValue_Select::GetSelectedValue(UObject* SourceObject, const FName& ItemName)
+{
+	SelectedItemIndex = BindingItems.IndexOfByKey(ItemName);
+
+	bool bDidUpdate = false;
+	return GetBindingItemValue(SourceObject, SelectedItemIndex, bDidUpdate);
+}
+
+bool UMDFastBindingValue_Select::IsBindingItemRelevantToUpdate(int32 ItemIndex) const
+{
+	const FMDFastBindingItem& BindingItem = BindingItems[ItemIndex];
+	return ItemIndex == SelectedItemIndex
+		|| BindingItem.ItemName == MDFastBindingValue_Select_Private::SelectValueInputName
+		|| BindingItem.ExtendablePinListNameBase == MDFastBindingValue_Select_Private::FromValueItemName;
+}
+
+void UMDFastBindingValue_Select::TerminateValue_Internal(UObject* SourceObject)
+{
+	Super::TerminateValue_Internal(SourceObject);
+
+	bNeedsPrefetch = false;
+	bIsAwaitingPrefetch = false;
+
+	FreeLookup();
+	SelectedItemIndex = INDEX_NONE;
+
+	// The handle is shared with other selects in the container, so just drop our reference instead of releasing it
+	PrefetchHandle.Reset();
+}
+
+int32 UMDFastBindingValue_Select::FindMatchingMapping(UObject* SourceObject, const TTuple<const FProperty*, void*>& InputValue)
+{
+	if (!bHasBuiltLookup || LookupKeyProp.Get() != InputValue.Key)
+	{
+		BuildLookup(SourceObject, InputValue.Key);
+	}
+
+	// Pins are matched in order, so the hashed match is only a candidate until the linear pins before it are checked
+	int32 MatchingItemIndex = INDEX_NONE;
+	if (!LookupKeysByHash.IsEmpty())
+	{
+		const uint32 InputHash = InputValue.Key->GetValueTypeHash(InputValue.Value);
+		for (auto It = LookupKeysByHash.CreateConstKeyIterator(InputHash); It; ++It)
+		{
+			const int32 KeyIndex = It.Value();
+			const int32 ItemIndex = LookupKeyItemIndices[KeyIndex];
+			if ((MatchingItemIndex == INDEX_NONE || ItemIndex < MatchingItemIndex) && InputValue.Key->Identical(GetLookupKey(KeyIndex), InputValue.Value))
 			{
-				const TTuple<const FProperty*, void*> ItemValue = BindingItem.GetValue(SourceObject, bDidUpdate);
-				if (FMDFastBindingHelpers::ArePropertyValuesEqual(ItemValue.Key, ItemValue.Value, InputValue.Key, InputValue.Value))
-				{
-					const FName& ResultValueName = FindOrCreateExtendableItemName(MDFastBindingValue_Select_Private::ToValueItemName, BindingItem.ExtendablePinListIndex);
-					return GetBindingItemValue(SourceObject, ResultValueName, bDidUpdate);
-				}
+				MatchingItemIndex = ItemIndex;
 			}
 		}
+	}
 
-		return GetBindingItemValue(SourceObject, MDFastBindingValue_Select_Private::FallbackResultInputName, bDidUpdate);
+	for (const int32 ItemIndex : LinearItemIndices)
+	{
+		if (MatchingItemIndex != INDEX_NONE && ItemIndex > MatchingItemIndex)
+		{
+			break;
+		}
+
+		bool bDidUpdate = false;
+		const TTuple<const FProperty*, void*> ItemValue = BindingItems[ItemIndex].GetValue(SourceObject, bDidUpdate);
+		if (FMDFastBindingHelpers::ArePropertyValuesEqual(ItemValue.Key, ItemValue.Value, InputValue.Key, InputValue.Value))
+		{
+			MatchingItemIndex = ItemIndex;
+			break;
+		}
 	}
 
-	return {};
+	return MatchingItemIndex;
+}
+
+void UMDFastBindingValue_Select::BuildLookup(UObject* SourceObject, const FProperty* InputProp)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	FreeLookup();
+	bHasBuiltLookup = true;
+	LookupKeyProp = InputProp;
+
+	TArray<int32> ConstantItemIndices;
+	for (int32 ItemIndex = 0; ItemIndex < BindingItems.Num(); ++ItemIndex)
+	{
+		const FMDFastBindingItem& BindingItem = BindingItems[ItemIndex];
+		if (BindingItem.ExtendablePinListIndex == INDEX_NONE || BindingItem.ExtendablePinListNameBase != MDFastBindingValue_Select_Private::FromValueItemName)
+		{
+			continue;
+		}
+
+		if (BindingItem.Value == nullptr && InputProp->HasAnyPropertyFlags(CPF_HasGetValueTypeHash))
+		{
+			ConstantItemIndices.Add(ItemIndex);
+		}
+		else
+		{
+			LinearItemIndices.Add(ItemIndex);
+		}
+	}
+
+	if (ConstantItemIndices.IsEmpty())
+	{
+		return;
+	}
+
+	LookupKeyStride = Align(InputProp->GetSize(), InputProp->GetMinAlignment());
+	LookupKeyData = static_cast<uint8*>(FMemory::Malloc(LookupKeyStride * ConstantItemIndices.Num(), InputProp->GetMinAlignment()));
+
+	for (const int32 ItemIndex : ConstantItemIndices)
+	{
+		bool bDidUpdate = false;
+		const TTuple<const FProperty*, void*> ItemValue = BindingItems[ItemIndex].GetValue(SourceObject, bDidUpdate);
+		const bool bCanConvert = ItemValue.Key != nullptr && ItemValue.Value != nullptr
+			&& (ItemValue.Key->SameType(InputProp) || FMDFastBindingModule::CanSetProperty(InputProp, ItemValue.Key));
+		if (!bCanConvert)
+		{
+			LinearItemIndices.Add(ItemIndex);
+			continue;
+		}
+
+		// Convert the pin's value to the input's type once here rather than on every comparison
+		const int32 KeyIndex = LookupKeyItemIndices.Add(ItemIndex);
+		void* KeyPtr = GetLookupKey(KeyIndex);
+		InputProp->InitializeValue(KeyPtr);
+		FMDFastBindingModule::SetPropertyDirectly(InputProp, KeyPtr, ItemValue.Key, ItemValue.Value);
+		LookupKeysByHash.Add(InputProp->GetValueTypeHash(KeyPtr), KeyIndex);
+	}
+
+	LinearItemIndices.Sort();
+}
+
+void UMDFastBindingValue_Select::FreeLookup()
+{
+	if (LookupKeyData != nullptr)
+	{
+		if (const FProperty* KeyProp = LookupKeyProp.Get())
+		{
+			for (int32 KeyIndex = 0; KeyIndex < LookupKeyItemIndices.Num(); ++KeyIndex)
+			{
+				KeyProp->DestroyValue(GetLookupKey(KeyIndex));
+			}
+		}
+
+		FMemory::Free(LookupKeyData);
+		LookupKeyData = nullptr;
+	}
+
+	LookupKeyProp.Reset();
+	LookupKeyStride = 0;
+	LookupKeyItemIndices.Reset();
+	LookupKeysByHash.Reset();
+	LinearItemIndices.Reset();
+	bHasBuiltLookup = false;
+}
+
+void* UMDFastBindingValue_Select::GetLookupKey(int32 KeyIndex) const
+{
+	return LookupKeyData + KeyIndex * LookupKeyStride;
 }
 
 void UMDFastBindingValue_Select::SetupBindingItems()
 {
+	FreeLookup();
+	SelectedItemIndex = INDEX_NONE;
+
 	EnsureBindingItemExists(MDFastBindingValue_Select_Private::SelectValueInputName, nullptr
 		, LOCTEXT("ValueInputDescription", "Based on the input to this pin, this node will select the output value."));
 
@@ -233,4 +416,63 @@ const FProperty* UMDFastBindingValue_Select::ResolveOutputProperty()
 	return nullptr;
 }
 
+void UMDFastBindingValue_Select::RequestPrefetch(UObject* SourceObject)
+{
+	if (!CastField<const FSoftObjectProperty>(ResolveOutputProperty()))
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> Paths;
+	for (int32 i = 0; i < BindingItems.Num(); ++i)
+	{
+		const FMDFastBindingItem& BindingItem = BindingItems[i];
+		if (BindingItem.ItemName == MDFastBindingValue_Select_Private::SelectValueInputName
+			|| BindingItem.ExtendablePinListNameBase == MDFastBindingValue_Select_Private::FromValueItemName)
+		{
+			continue;
+		}
+
+		bool bDidUpdate = false;
+		const TTuple<const FProperty*, void*> ResultValue = GetBindingItemValue(SourceObject, i, bDidUpdate);
+		const FSoftObjectProperty* SoftObjectProp = CastField<const FSoftObjectProperty>(ResultValue.Key);
+		if (SoftObjectProp != nullptr && ResultValue.Value != nullptr)
+		{
+			const FSoftObjectPath Path = SoftObjectProp->GetPropertyValue(ResultValue.Value).ToSoftObjectPath();
+			if (!Path.IsNull())
+			{
+				Paths.AddUnique(Path);
+			}
+		}
+	}
+
+	if (Paths.IsEmpty())
+	{
+		return;
+	}
+
+	// Batch with the rest of the container so a screen full of selects becomes a single load request
+	const UMDFastBindingInstance* Binding = GetOuterBinding();
+	const UObject* BatchOwner = Binding != nullptr ? static_cast<const UObject*>(Binding->GetBindingContainer()) : nullptr;
+	bIsAwaitingPrefetch = true;
+	FMDFastBindingAssetPrefetcher::Get().RequestPrefetch(BatchOwner != nullptr ? BatchOwner : this, Paths
+		, FMDFastBindingOnPrefetchRequested::CreateUObject(this, &UMDFastBindingValue_Select::OnPrefetchRequested));
+}
+
+void UMDFastBindingValue_Select::OnPrefetchRequested(TSharedPtr<FStreamableHandle> Handle)
+{
+	// The binding may have been terminated while the request was queued
+	if (!bIsAwaitingPrefetch)
+	{
+		return;
+	}
+
+	bIsAwaitingPrefetch = false;
+
+	if (PrefetchMode == EMDFastBindingSelectPrefetchMode::KeepResident)
+	{
+		PrefetchHandle = Handle;
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,208 @@
+#include "BindingValues/MDFastBindingValue_Temporal.h"
+
+#include "Util/MDFastBindingScheduler.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingValue_Temporal"
+
+namespace MDFastBindingValue_Temporal_Private
+{
+	const FName ValueName = TEXT("Value");
+}
+
+void UMDFastBindingValue_Temporal::BeginDestroy()
+{
+	Super::BeginDestroy();
+
+	if (OutputValue.Value != nullptr)
+	{
+		FMemory::Free(OutputValue.Value);
+		OutputValue.Value = nullptr;
+	}
+}
+
+const FProperty* UMDFastBindingValue_Temporal::GetOutputProperty()
+{
+	return ResolveOutputProperty();
+}
+
+bool UMDFastBindingValue_Temporal::IsSchedulingBoundary() const
+{
+	// Debounce has to read its input as often as it changes to know when it has settled
+	return TemporalMode != EMDFastBindingTemporalMode::Debounce;
+}
+
+#if WITH_EDITORONLY_DATA
+FText UMDFastBindingValue_Temporal::GetDisplayName()
+{
+	if (const UEnum* ModeEnum = StaticEnum<EMDFastBindingTemporalMode>())
+	{
+		return ModeEnum->GetDisplayNameTextByValue(static_cast<int64>(TemporalMode));
+	}
+
+	return Super::GetDisplayName();
+}
+#endif
+
+bool UMDFastBindingValue_Temporal::CheckNeedsUpdate() const
+{
+	if (!HasCachedValue() || IsObjectDirty())
+	{
+		// Either we haven't output anything yet or the scheduler woke us up
+		return true;
+	}
+
+	switch (TemporalMode)
+	{
+	case EMDFastBindingTemporalMode::Debounce:
+		// Input changes have to be read to know when the input was last changed
+		return CheckBindingItemsNeedUpdate();
+	case EMDFastBindingTemporalMode::Throttle:
+		// Changes before then are picked up by the wake-up scheduled when we last output
+		return FMDFastBindingScheduler::GetCurrentTime() >= LastOutputTime + Interval && CheckBindingItemsNeedUpdate();
+	case EMDFastBindingTemporalMode::Sample:
+	default:
+		return false;
+	}
+}
+
+void UMDFastBindingValue_Temporal::InitializeValue_Internal(UObject* SourceObject)
+{
+	Super::InitializeValue_Internal(SourceObject);
+
+	FreeOutput();
+	LastOutputTime = 0.0;
+	LastInputChangeTime = 0.0;
+	bHasPendingInput = false;
+}
+
+TTuple<const FProperty*, void*> UMDFastBindingValue_Temporal::GetValue_Internal(UObject* SourceObject)
+{
+	bool bDidUpdate = false;
+	const TTuple<const FProperty*, void*> Input = GetBindingItemValue(SourceObject, MDFastBindingValue_Temporal_Private::ValueName, bDidUpdate);
+	if (Input.Key == nullptr || Input.Value == nullptr)
+	{
+		return OutputValue.Value != nullptr ? OutputValue : Input;
+	}
+
+	const double CurrentTime = FMDFastBindingScheduler::GetCurrentTime();
+	switch (TemporalMode)
+	{
+	case EMDFastBindingTemporalMode::Debounce:
+		if (OutputValue.Value == nullptr)
+		{
+			StoreOutput(Input.Key, Input.Value);
+		}
+		else if (bDidUpdate)
+		{
+			bHasPendingInput = true;
+			LastInputChangeTime = CurrentTime;
+			if (Interval > 0.f)
+			{
+				FMDFastBindingScheduler::Get().ScheduleWakeUp(this, CurrentTime + Interval);
+			}
+		}
+
+		if (bHasPendingInput && CurrentTime >= LastInputChangeTime + Interval)
+		{
+			bHasPendingInput = false;
+			StoreOutput(Input.Key, Input.Value);
+		}
+		break;
+	case EMDFastBindingTemporalMode::Throttle:
+		// A change read too early is held until the interval is up, by then the input won't report it as an update anymore
+		bHasPendingInput |= bDidUpdate;
+		if (OutputValue.Value == nullptr || (bHasPendingInput && CurrentTime >= LastOutputTime + Interval))
+		{
+			bHasPendingInput = false;
+			StoreOutput(Input.Key, Input.Value);
+
+			// Wake up once we're allowed to output again in case the input changes before then, if it doesn't we go back to sleep
+			FMDFastBindingScheduler::Get().ScheduleWakeUp(this, CurrentTime + Interval);
+		}
+		else if (bHasPendingInput)
+		{
+			FMDFastBindingScheduler::Get().ScheduleWakeUp(this, LastOutputTime + Interval);
+		}
+		break;
+	case EMDFastBindingTemporalMode::Sample:
+		StoreOutput(Input.Key, Input.Value);
+		FMDFastBindingScheduler::Get().ScheduleWakeUp(this, CurrentTime + Interval);
+		break;
+	}
+
+	return OutputValue;
+}
+
+void UMDFastBindingValue_Temporal::TerminateValue_Internal(UObject* SourceObject)
+{
+	FMDFastBindingScheduler::Get().CancelWakeUp(this);
+	FreeOutput();
+
+	Super::TerminateValue_Internal(SourceObject);
+}
+
+void UMDFastBindingValue_Temporal::SetupBindingItems()
+{
+	Super::SetupBindingItems();
+
+	EnsureBindingItemExists(MDFastBindingValue_Temporal_Private::ValueName, ResolveOutputProperty()
+		, LOCTEXT("ValueToolTip", "The value to pass through, only read when the node is due to output"));
+}
+
+const FProperty* UMDFastBindingValue_Temporal::ResolveOutputProperty()
+{
+#if !WITH_EDITOR
+	if (ResolvedOutputProperty.IsValid())
+	{
+		return ResolvedOutputProperty.Get();
+	}
+#endif
+
+	if (const FMDFastBindingItem* OwningItem = GetOwningBindingItem())
+	{
+		if (const FProperty* OwningItemProp = OwningItem->ItemProperty.Get())
+		{
+			ResolvedOutputProperty = OwningItemProp;
+			return OwningItemProp;
+		}
+	}
+
+	if (const FProperty* ValueProp = GetBindingItemValueProperty(MDFastBindingValue_Temporal_Private::ValueName))
+	{
+		ResolvedOutputProperty = ValueProp;
+		return ValueProp;
+	}
+
+	return nullptr;
+}
+
+void UMDFastBindingValue_Temporal::StoreOutput(const FProperty* InputProp, const void* InputValuePtr)
+{
+	if (OutputValue.Key != InputProp)
+	{
+		FreeOutput();
+	}
+
+	if (OutputValue.Value == nullptr)
+	{
+		OutputValue.Key = InputProp;
+		OutputValue.Value = FMemory::Malloc(InputProp->GetSize(), InputProp->GetMinAlignment());
+		InputProp->InitializeValue(OutputValue.Value);
+	}
+
+	InputProp->CopyCompleteValue(OutputValue.Value, InputValuePtr);
+	LastOutputTime = FMDFastBindingScheduler::GetCurrentTime();
+}
+
+void UMDFastBindingValue_Temporal::FreeOutput()
+{
+	if (OutputValue.Value != nullptr)
+	{
+		OutputValue.Key->DestroyValue(OutputValue.Value);
+		FMemory::Free(OutputValue.Value);
+	}
+
+	OutputValue = {};
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,143 @@
+#include "BindingValues/MDFastBindingValue_Time.h"
+
+#include "MDFastBinding.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "Util/MDFastBindingScheduler.h"
+
+#define LOCTEXT_NAMESPACE "MDFastBindingValue_Time"
+
+namespace MDFastBindingValue_Time_Private
+{
+	const FName ReferenceTimeName = TEXT("Reference Time");
+
+	// The longest we sleep while the world is paused or dilated, so a change to the pause state or dilation is picked up promptly
+	constexpr double DilatedTimePollInterval = 0.5;
+}
+
+const FProperty* UMDFastBindingValue_Time::GetOutputProperty()
+{
+	return GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Time, OutputValue));
+}
+
+#if WITH_EDITORONLY_DATA
+FText UMDFastBindingValue_Time::GetDisplayName()
+{
+	if (const UEnum* ModeEnum = StaticEnum<EMDFastBindingTimeMode>())
+	{
+		return ModeEnum->GetDisplayNameTextByValue(static_cast<int64>(TimeMode));
+	}
+
+	return Super::GetDisplayName();
+}
+#endif
+
+TTuple<const FProperty*, void*> UMDFastBindingValue_Time::GetValue_Internal(UObject* SourceObject)
+{
+	bool bDidUpdate = false;
+	const TTuple<const FProperty*, void*> Reference = GetBindingItemValue(SourceObject, MDFastBindingValue_Time_Private::ReferenceTimeName, bDidUpdate);
+	if (Reference.Key != nullptr && Reference.Value != nullptr)
+	{
+		const FProperty* ReferenceTimeProp = GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Time, ReferenceTime));
+		if (Reference.Key->SameType(ReferenceTimeProp))
+		{
+			ReferenceTime = *static_cast<const double*>(Reference.Value);
+		}
+		else
+		{
+			FMDFastBindingModule::SetPropertyDirectly(ReferenceTimeProp, &ReferenceTime, Reference.Key, Reference.Value);
+		}
+	}
+
+	const UWorld* World = SourceObject != nullptr ? SourceObject->GetWorld() : nullptr;
+	if (World == nullptr)
+	{
+		return TTuple<const FProperty*, void*>{ GetOutputProperty(), &OutputValue };
+	}
+
+	const double CurrentTime = TimeSource == EMDFastBindingTimeSource::WorldTime ? World->GetTimeSeconds() : World->GetRealTimeSeconds();
+	ScheduleNextUpdate(World, UpdateOutput(CurrentTime));
+
+	return TTuple<const FProperty*, void*>{ GetOutputProperty(), &OutputValue };
+}
+
+void UMDFastBindingValue_Time::TerminateValue_Internal(UObject* SourceObject)
+{
+	FMDFastBindingScheduler::Get().CancelWakeUp(this);
+
+	Super::TerminateValue_Internal(SourceObject);
+}
+
+void UMDFastBindingValue_Time::SetupBindingItems()
+{
+	Super::SetupBindingItems();
+
+	EnsureBindingItemExists(MDFastBindingValue_Time_Private::ReferenceTimeName
+		, GetClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UMDFastBindingValue_Time, ReferenceTime))
+		, LOCTEXT("ReferenceTimeToolTip", "The time to count from or to, in the same time source as this node. Not used by Now.")
+		, true);
+}
+
+double UMDFastBindingValue_Time::UpdateOutput(double CurrentTime)
+{
+	if (TimeMode == EMDFastBindingTimeMode::TimeUntil)
+	{
+		const double Remaining = ReferenceTime - CurrentTime;
+		if (Remaining <= 0.0)
+		{
+			OutputValue = 0.0;
+			return -1.0;
+		}
+
+		if (Resolution <= 0.0)
+		{
+			OutputValue = Remaining;
+			return 0.0;
+		}
+
+		// Round up so a countdown shows 1 until it actually reaches 0
+		OutputValue = FMath::CeilToDouble(Remaining / Resolution) * Resolution;
+		return Remaining - (OutputValue - Resolution);
+	}
+
+	const double Elapsed = TimeMode == EMDFastBindingTimeMode::TimeSince ? CurrentTime - ReferenceTime : CurrentTime;
+	if (Resolution <= 0.0)
+	{
+		OutputValue = Elapsed;
+		return 0.0;
+	}
+
+	OutputValue = FMath::FloorToDouble(Elapsed / Resolution) * Resolution;
+	return (OutputValue + Resolution) - Elapsed;
+}
+
+void UMDFastBindingValue_Time::ScheduleNextUpdate(const UWorld* World, double SourceSecondsUntilChange)
+{
+	if (SourceSecondsUntilChange < 0.0)
+	{
+		// The output won't change again unless Reference Time does
+		FMDFastBindingScheduler::Get().CancelWakeUp(this);
+		return;
+	}
+
+	double RealSecondsUntilChange = SourceSecondsUntilChange;
+	if (TimeSource == EMDFastBindingTimeSource::WorldTime)
+	{
+		const AWorldSettings* WorldSettings = World->GetWorldSettings();
+		const double TimeDilation = WorldSettings != nullptr ? WorldSettings->GetEffectiveTimeDilation() : 1.0;
+		if (World->IsPaused() || TimeDilation <= UE_KINDA_SMALL_NUMBER)
+		{
+			RealSecondsUntilChange = MDFastBindingValue_Time_Private::DilatedTimePollInterval;
+		}
+		else if (TimeDilation != 1.0)
+		{
+			// Dilation can change while we sleep, so don't trust it for long
+			RealSecondsUntilChange = FMath::Min(SourceSecondsUntilChange / TimeDilation, MDFastBindingValue_Time_Private::DilatedTimePollInterval);
+		}
+	}
+
+	// Waking early is harmless, the output is recalculated and the next update rescheduled
+	FMDFastBindingScheduler::Get().ScheduleWakeUp(this, FMDFastBindingScheduler::GetCurrentTime() + RealSecondsUntilChange);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -6,6 +6,10 @@
 #include "PropertySetters/MDFastBindingPropertySetter_Numeric.h"
 #include "PropertySetters/MDFastBindingPropertySetter_Objects.h"
 #include "UObject/UnrealType.h"
+#include "Util/MDFastBindingAssetPrefetcher.h"
+#include "Util/MDFastBindingNumberTextCache.h"
+#include "Util/MDFastBindingScheduler.h"
+#include "WidgetExtension/MDFastBindingWidgetBatchUpdater.h"
 
 #define LOCTEXT_NAMESPACE "FMDFastBindingModule"
 
@@ -19,6 +23,10 @@ void FMDFastBindingModule::StartupModule()
 
 void FMDFastBindingModule::ShutdownModule()
 {
+	FMDFastBindingWidgetBatchUpdater::Get().Shutdown();
+	FMDFastBindingAssetPrefetcher::Get().Shutdown();
+	FMDFastBindingNumberTextCache::Get().Shutdown();
+	FMDFastBindingScheduler::Get().Shutdown();
 }
 
 void FMDFastBindingModule::AddPropertySetter(TSharedRef<IMDFastBindingPropertySetter> InPropertySetter)
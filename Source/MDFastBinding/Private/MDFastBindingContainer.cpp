@@ -4,7 +4,14 @@
 #include "MDFastBindingOwnerInterface.h"
 #include "BindingDestinations/MDFastBindingDestinationBase.h"
 #include "Blueprint/UserWidget.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Util/MDFastBindingConfig.h"
 #include "WidgetExtension/MDFastBindingWidgetExtension.h"
+#if ENGINE_MAJOR_VERSION > 5 || ENGINE_MINOR_VERSION >= 3
+#include "INotifyFieldValueChanged.h"
+#else
+#include "FieldNotification/IFieldValueChanged.h"
+#endif
 
 void UMDFastBindingContainer::InitializeBindings(UObject* SourceObject)
 {
@@ -13,6 +20,8 @@ void UMDFastBindingContainer::InitializeBindings(UObject* SourceObject)
 		UE_CLOG(!OuterWidget->IsDesignTime(), LogMDFastBinding, Warning, TEXT("[%s] uses a deprecated property-based MDFastBindingContainer, resave it to automatically upgrade it to a widget extension"), *GetNameSafe(OuterWidget->GetClass()));
 	}
 
+	bIsDeferringDestinationWrites = GetDefault<UMDFastBindingConfig>()->ShouldDeferDestinationWrites();
+
 	TickingBindings.Insert(false, 0, Bindings.Num());
 
 	for (int32 i = 0; i < Bindings.Num(); ++i)
@@ -23,6 +32,8 @@ void UMDFastBindingContainer::InitializeBindings(UObject* SourceObject)
 			TickingBindings[i] = Binding->UpdateBinding(SourceObject);
 		}
 	}
+
+	CommitDestinations();
 }
 
 void UMDFastBindingContainer::UpdateBindings(UObject* SourceObject)
@@ -34,6 +45,21 @@ void UMDFastBindingContainer::UpdateBindings(UObject* SourceObject)
 	{
 		TickingBindings[It.GetIndex()] = Bindings[It.GetIndex()]->UpdateBinding(SourceObject);
 	}
+
+	CommitDestinations();
+}
+
+void UMDFastBindingContainer::UpdateBinding(UObject* SourceObject, int32 BindingIndex)
+{
+	if (TickingBindings.IsValidIndex(BindingIndex) && TickingBindings[BindingIndex])
+	{
+		TickingBindings[BindingIndex] = Bindings[BindingIndex]->UpdateBinding(SourceObject);
+	}
+}
+
+void UMDFastBindingContainer::FinishUpdatingBindings()
+{
+	CommitDestinations();
 }
 
 void UMDFastBindingContainer::TerminateBindings(UObject* SourceObject)
@@ -44,6 +70,8 @@ void UMDFastBindingContainer::TerminateBindings(UObject* SourceObject)
 	}
 
 	TickingBindings.Reset();
+	PendingCommits.Reset();
+	PendingFieldValueChanges.Reset();
 }
 
 void UMDFastBindingContainer::SetBindingTickPolicy(UMDFastBindingInstance* Binding, bool bShouldTick)
@@ -62,6 +90,22 @@ void UMDFastBindingContainer::SetBindingTickPolicy(UMDFastBindingInstance* Bindi
 	}
 }
 
+void UMDFastBindingContainer::QueueDestinationCommit(UMDFastBindingDestinationBase* Destination, UObject* TargetObject)
+{
+	if (Destination != nullptr)
+	{
+		PendingCommits.Add({ TargetObject, Destination });
+	}
+}
+
+void UMDFastBindingContainer::QueueFieldValueChangedBroadcast(UObject* TargetObject, const UE::FieldNotification::FFieldId& FieldId)
+{
+	if (TargetObject != nullptr && FieldId.IsValid())
+	{
+		PendingFieldValueChanges.Add({ TargetObject, FieldId });
+	}
+}
+
 UClass* UMDFastBindingContainer::GetBindingOwnerClass() const
 {
 	if (const UObject* Outer = GetOuter())
@@ -151,6 +195,17 @@ EDataValidationResult UMDFastBindingContainer::IsDataValid(TArray<FText>& Valida
 
 	return Result;
 }
+
+void UMDFastBindingContainer::OptimizeForRuntime()
+{
+	for (UMDFastBindingInstance* Binding : Bindings)
+	{
+		if (Binding != nullptr)
+		{
+			Binding->OptimizeForRuntime();
+		}
+	}
+}
 #endif
 
 void UMDFastBindingContainer::UpdateNeedsTick()
@@ -160,3 +215,48 @@ void UMDFastBindingContainer::UpdateNeedsTick()
 		Extension->UpdateNeedsTick();
 	}
 }
+
+void UMDFastBindingContainer::CommitDestinations()
+{
+	if (PendingCommits.IsEmpty())
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	// Group the writes by target so each target object is written to in one go, stable so bindings on the same target keep their order
+	PendingCommits.StableSort([](const FPendingDestinationCommit& A, const FPendingDestinationCommit& B)
+	{
+		return A.TargetObject < B.TargetObject;
+	});
+
+	for (const FPendingDestinationCommit& Commit : PendingCommits)
+	{
+		Commit.Destination->CommitDestination();
+	}
+
+	PendingCommits.Reset();
+
+	// Broadcast each changed field once per target, even if multiple bindings wrote to it
+	PendingFieldValueChanges.Sort([](const FPendingFieldValueChanged& A, const FPendingFieldValueChanged& B)
+	{
+		return A.TargetObject != B.TargetObject ? A.TargetObject < B.TargetObject : A.FieldId.GetIndex() < B.FieldId.GetIndex();
+	});
+
+	for (int32 i = 0; i < PendingFieldValueChanges.Num(); ++i)
+	{
+		const FPendingFieldValueChanged& FieldChange = PendingFieldValueChanges[i];
+		if (i > 0 && PendingFieldValueChanges[i - 1].TargetObject == FieldChange.TargetObject && PendingFieldValueChanges[i - 1].FieldId == FieldChange.FieldId)
+		{
+			continue;
+		}
+
+		if (INotifyFieldValueChanged* FieldNotify = Cast<INotifyFieldValueChanged>(FieldChange.TargetObject))
+		{
+			FieldNotify->BroadcastFieldValueChanged(FieldChange.FieldId);
+		}
+	}
+
+	PendingFieldValueChanges.Reset();
+}
@@ -10,6 +10,8 @@ FMDFastBindingFunctionWrapper::~FMDFastBindingFunctionWrapper()
 		FMemory::Free(FunctionMemory);
 		FunctionMemory = nullptr;
 	}
+
+	FreeLastCallParamMemory();
 }
 
 bool FMDFastBindingFunctionWrapper::BuildFunctionData()
@@ -89,6 +91,17 @@ TTuple<const FProperty*, void*> FMDFastBindingFunctionWrapper::CallFunction(UObj
 		return {};
 	}
 
+	// Functions without params have nothing to compare, they're called for their side effects
+	if (bSkipCallIfParamsUnchanged && !CachedParams.IsEmpty())
+	{
+		if (AreParamsIdenticalToLastCall(FunctionOwner))
+		{
+			return {};
+		}
+
+		StoreLastCallParams(FunctionOwner);
+	}
+
 	FunctionOwner->ProcessEvent(FunctionPtr, FunctionMemory);
 
 	if (CachedReturnProp != nullptr)
@@ -207,6 +220,75 @@ void FMDFastBindingFunctionWrapper::PopulateParams(UObject* SourceObject)
 	}
 }
 
+bool FMDFastBindingFunctionWrapper::AreParamsIdenticalToLastCall(const UObject* FunctionOwner) const
+{
+	if (!bHasLastCallParams || LastCallParamMemory == nullptr || LastCallFunction.Get() != FunctionPtr || LastCallOwner.Get() != FunctionOwner)
+	{
+		return false;
+	}
+
+	for (const FProperty* Param : LastCallParams)
+	{
+		if (!Param->Identical_InContainer(FunctionMemory, LastCallParamMemory))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FMDFastBindingFunctionWrapper::StoreLastCallParams(UObject* FunctionOwner)
+{
+	if (LastCallFunction.Get() != FunctionPtr || LastCallParams != CachedParams)
+	{
+		FreeLastCallParamMemory();
+	}
+
+	if (LastCallParamMemory == nullptr)
+	{
+		LastCallParams = CachedParams;
+		LastCallParamMemory = FMemory::Malloc(FunctionPtr->ParmsSize, FunctionPtr->GetMinAlignment());
+		for (const FProperty* Param : LastCallParams)
+		{
+			Param->InitializeValue_InContainer(LastCallParamMemory);
+		}
+
+		LastCallFunction = FunctionPtr;
+	}
+
+	for (const FProperty* Param : LastCallParams)
+	{
+		Param->CopyCompleteValue_InContainer(LastCallParamMemory, FunctionMemory);
+	}
+
+	LastCallOwner = FunctionOwner;
+	bHasLastCallParams = true;
+}
+
+void FMDFastBindingFunctionWrapper::FreeLastCallParamMemory()
+{
+	if (LastCallParamMemory != nullptr)
+	{
+		// If the function has gone away, we can't safely destroy the values so just free the memory
+		if (LastCallFunction.IsValid())
+		{
+			for (const FProperty* Param : LastCallParams)
+			{
+				Param->DestroyValue_InContainer(LastCallParamMemory);
+			}
+		}
+
+		FMemory::Free(LastCallParamMemory);
+		LastCallParamMemory = nullptr;
+	}
+
+	LastCallParams.Reset();
+	LastCallFunction.Reset();
+	LastCallOwner.Reset();
+	bHasLastCallParams = false;
+}
+
 void FMDFastBindingFunctionWrapper::FixupFunctionMember()
 {
 	if (UClass* OwnerClass = GetFunctionOwnerClass())
@@ -6,6 +6,8 @@
 
 #include "MDFastBinding.h"
 #include "Blueprint/WidgetBlueprintGeneratedClass.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "WidgetExtension/MDFastBindingWidgetClassExtension.h"
 
 void FMDFastBindingHelpers::GetFunctionParamProps(const UFunction* Func, TArray<const FProperty*>& OutParams)
@@ -139,3 +141,14 @@ bool FMDFastBindingHelpers::DoesClassHaveSuperClassBindings(UWidgetBlueprintGene
 
 	return false;
 }
+
+FStreamableManager& FMDFastBindingHelpers::GetStreamableManager()
+{
+	if (UAssetManager::IsValid())
+	{
+		return UAssetManager::GetStreamableManager();
+	}
+
+	static FStreamableManager FallbackStreamableManager;
+	return FallbackStreamableManager;
+}
@@ -132,6 +132,17 @@ void UMDFastBindingInstance::OnVariableRenamed(UClass* VariableClass, const FNam
 	}
 }
 
+void UMDFastBindingInstance::OptimizeForRuntime()
+{
+	if (BindingDestination != nullptr)
+	{
+		if (UMDFastBindingDestinationBase* Replacement = BindingDestination->CreateRuntimeReplacement())
+		{
+			BindingDestination = Replacement;
+		}
+	}
+}
+
 bool UMDFastBindingInstance::IsBindingPerformant() const
 {
 	if (BindingDestination != nullptr)
@@ -145,10 +156,10 @@ bool UMDFastBindingInstance::IsBindingPerformant() const
 				return true;
 			}
 
-			const EMDFastBindingUpdateType UpdateType = BindingObject->GetUpdateType();
-			if (UpdateType == EMDFastBindingUpdateType::Once)
+			const EMDFastBindingUpdateType UpdateType = BindingObject->GetEffectiveUpdateType();
+			if (UpdateType == EMDFastBindingUpdateType::Once || UpdateType == EMDFastBindingUpdateType::Interval || BindingObject->IsSchedulingBoundary())
 			{
-				// Once doesn't care about their binding items when deciding update frequency
+				// Once, Interval and scheduling boundaries don't care about their binding items when deciding update frequency
 				return true;
 			}
 
@@ -7,6 +7,7 @@
 #include "BindingValues/MDFastBindingValueBase.h"
 #include "UObject/ObjectSaveContext.h"
 #include "UObject/TextProperty.h"
+#include "Util/MDFastBindingScheduler.h"
 
 #if WITH_EDITORONLY_DATA
 #include "Misc/App.h"
@@ -261,26 +262,44 @@ UMDFastBindingInstance* UMDFastBindingObject::GetOuterBinding() const
 
 bool UMDFastBindingObject::CheckNeedsUpdate() const
 {
-	if (UpdateType == EMDFastBindingUpdateType::Always)
+	const EMDFastBindingUpdateType EffectiveUpdateType = GetEffectiveUpdateType();
+	if (EffectiveUpdateType == EMDFastBindingUpdateType::Always)
 	{
 		return true;
 	}
 
-	if (UpdateType == EMDFastBindingUpdateType::EventBased && bIsObjectDirty)
+	if (bIsObjectDirty)
 	{
-		// If dirty and event based, then we must update
+		// Something external (eg. an event or a culture change) told us we must update
 		return true;
 	}
 
-	if (UpdateType == EMDFastBindingUpdateType::Once)
+	if (EffectiveUpdateType == EMDFastBindingUpdateType::Once)
 	{
 		// Assume the child classes check for this
 		return false;
 	}
 
+	if (EffectiveUpdateType == EMDFastBindingUpdateType::Interval)
+	{
+		// The scheduler marks us dirty once the interval is up
+		return false;
+	}
+
+	return CheckBindingItemsNeedUpdate();
+}
+
+bool UMDFastBindingObject::CheckBindingItemsNeedUpdate() const
+{
 	// TODO - Optimize - Cache whether downstream items could ever possibly need an update when this object doesn't
-	for (const FMDFastBindingItem& Item : BindingItems)
+	for (int32 ItemIndex = 0; ItemIndex < BindingItems.Num(); ++ItemIndex)
 	{
+		if (!IsBindingItemRelevantToUpdate(ItemIndex))
+		{
+			continue;
+		}
+
+		const FMDFastBindingItem& Item = BindingItems[ItemIndex];
 		if (Item.Value != nullptr && Item.Value->CheckCachedNeedsUpdate())
 		{
 			return true;
@@ -341,8 +360,6 @@ void UMDFastBindingObject::RemoveExtendablePinBindingItem(int32 ItemIndex)
 
 void UMDFastBindingObject::MarkObjectDirty()
 {
-	check(UpdateType == EMDFastBindingUpdateType::EventBased);
-
 	bIsObjectDirty = true;
 
 	if (UMDFastBindingInstance* BindingInstance = GetOuterBinding())
@@ -354,6 +371,11 @@ void UMDFastBindingObject::MarkObjectDirty()
 void UMDFastBindingObject::MarkObjectClean()
 {
 	bIsObjectDirty = false;
+
+	if (UpdateType == EMDFastBindingUpdateType::Interval)
+	{
+		FMDFastBindingScheduler::Get().ScheduleWakeUp(this, FMDFastBindingScheduler::GetCurrentTime() + UpdateInterval);
+	}
 }
 
 bool UMDFastBindingObject::CheckCachedNeedsUpdate() const
@@ -507,7 +529,7 @@ EDataValidationResult UMDFastBindingObject::IsDataValid(TArray<FText>& Validatio
 				return EDataValidationResult::Invalid;
 			}
 
-			if (!FMDFastBindingModule::CanSetProperty(BindingItem.ResolveOutputProperty(), OutputProp))
+			if (!CanBindingItemAcceptValue(BindingItem, OutputProp))
 			{
 				ValidationErrors.Add(FText::Format(LOCTEXT("BindingItemTypeMismatchError", "Pin '{0}' expects type '{1}' but Value '{2}' has type '{3}'")
 					, FText::FromName(BindingItem.ItemName)
@@ -522,6 +544,11 @@ EDataValidationResult UMDFastBindingObject::IsDataValid(TArray<FText>& Validatio
 	return EDataValidationResult::Valid;
 }
 
+bool UMDFastBindingObject::CanBindingItemAcceptValue(const FMDFastBindingItem& BindingItem, const FProperty* ValueProp) const
+{
+	return FMDFastBindingModule::CanSetProperty(BindingItem.ResolveOutputProperty(), ValueProp);
+}
+
 void UMDFastBindingObject::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
@@ -0,0 +1,64 @@
+#include "PropertySetters/MDFastBindingPropertySetter_Text.h"
+#include "Internationalization/Text.h"
+#include "UObject/UnrealType.h"
+#include "Util/MDFastBindingNumberTextCache.h"
+
+void FMDFastBindingPropertySetter_Text::SetPropertyInContainer(const FProperty& DestinationProp, void* DestinationContainerPtr, const FProperty& SourceProp, const void* SourceValuePtr) const
+{
+	const FText Value = ToText(SourceProp, SourceValuePtr);
+	DestinationProp.SetValue_InContainer(DestinationContainerPtr, &Value);
+}
+
+void FMDFastBindingPropertySetter_Text::SetPropertyDirectly(const FProperty& DestinationProp, void* DestinationValuePtr, const FProperty& SourceProp, const void* SourceValuePtr) const
+{
+	*static_cast<FText*>(DestinationValuePtr) = ToText(SourceProp, SourceValuePtr);
+}
+
+bool FMDFastBindingPropertySetter_Text::CanSetProperty(const FProperty& DestinationProp, const FProperty& SourceProp) const
+{
+	return DestinationProp.IsA<FTextProperty>() && CanConvertToText(SourceProp);
+}
+
+bool FMDFastBindingPropertySetter_Text::CanConvertToText(const FProperty& SourceProp)
+{
+	return SourceProp.IsA<FNumericProperty>() || SourceProp.IsA<FStrProperty>() || SourceProp.IsA<FNameProperty>();
+}
+
+FText FMDFastBindingPropertySetter_Text::NumericToText(const FNumericProperty& NumericProp, const void* ValuePtr)
+{
+	if (NumericProp.IsFloatingPoint())
+	{
+		return FMDFastBindingNumberTextCache::Get().AsNumber(NumericProp.GetFloatingPointPropertyValue(ValuePtr));
+	}
+
+	if (NumericProp.IsA<FUInt64Property>())
+	{
+		const uint64 UnsignedValue = NumericProp.GetUnsignedIntPropertyValue(ValuePtr);
+		return UnsignedValue <= static_cast<uint64>(MAX_int64)
+			? FMDFastBindingNumberTextCache::Get().AsNumber(static_cast<int64>(UnsignedValue))
+			: FText::AsNumber(UnsignedValue);
+	}
+
+	// Everything else fits in an int64 and GetSignedIntPropertyValue zero-extends the smaller unsigned types
+	return FMDFastBindingNumberTextCache::Get().AsNumber(NumericProp.GetSignedIntPropertyValue(ValuePtr));
+}
+
+FText FMDFastBindingPropertySetter_Text::ToText(const FProperty& SourceProp, const void* SourceValuePtr)
+{
+	if (const FNumericProperty* NumericProp = CastField<const FNumericProperty>(&SourceProp))
+	{
+		return NumericToText(*NumericProp, SourceValuePtr);
+	}
+
+	if (const FStrProperty* StrProp = CastField<const FStrProperty>(&SourceProp))
+	{
+		return FText::FromString(StrProp->GetPropertyValue(SourceValuePtr));
+	}
+
+	if (const FNameProperty* NameProp = CastField<const FNameProperty>(&SourceProp))
+	{
+		return FText::FromName(NameProp->GetPropertyValue(SourceValuePtr));
+	}
+
+	return FText::GetEmpty();
+}
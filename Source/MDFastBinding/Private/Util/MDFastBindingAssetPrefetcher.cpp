@@ -0,0 +1,98 @@
+#include "Util/MDFastBindingAssetPrefetcher.h"
+
+#include "MDFastBindingHelpers.h"
+#include "Engine/StreamableManager.h"
+#include "Util/MDFastBindingConfig.h"
+
+FMDFastBindingAssetPrefetcher& FMDFastBindingAssetPrefetcher::Get()
+{
+	static FMDFastBindingAssetPrefetcher Instance;
+	return Instance;
+}
+
+void FMDFastBindingAssetPrefetcher::RequestPrefetch(const UObject* BatchOwner, const TArray<FSoftObjectPath>& Paths, FMDFastBindingOnPrefetchRequested&& OnRequested)
+{
+	FPrefetchBatch* Batch = PendingBatches.FindByPredicate([BatchOwner](const FPrefetchBatch& InBatch)
+	{
+		return InBatch.Owner.Get() == BatchOwner;
+	});
+
+	if (Batch == nullptr)
+	{
+		Batch = &PendingBatches.AddDefaulted_GetRef();
+		Batch->Owner = BatchOwner;
+	}
+
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		if (!Path.IsNull())
+		{
+			Batch->Paths.AddUnique(Path);
+		}
+	}
+
+	Batch->Callbacks.Add(MoveTemp(OnRequested));
+
+	if (!TickHandle.IsValid())
+	{
+		TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMDFastBindingAssetPrefetcher::Tick));
+	}
+}
+
+void FMDFastBindingAssetPrefetcher::Shutdown()
+{
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+
+	PendingBatches.Reset();
+}
+
+bool FMDFastBindingAssetPrefetcher::Tick(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	const int32 MaxBatches = FMath::Max(1, GetDefault<UMDFastBindingConfig>()->GetMaxPrefetchBatchesPerFrame());
+	const int32 NumToIssue = FMath::Min(MaxBatches, PendingBatches.Num());
+
+	// Issuing may call back into bindings that queue more prefetches, so pull the batches out first
+	TArray<FPrefetchBatch> BatchesToIssue;
+	BatchesToIssue.Reserve(NumToIssue);
+	for (int32 i = 0; i < NumToIssue; ++i)
+	{
+		BatchesToIssue.Add(MoveTemp(PendingBatches[i]));
+	}
+	PendingBatches.RemoveAt(0, NumToIssue);
+
+	for (FPrefetchBatch& Batch : BatchesToIssue)
+	{
+		IssueBatch(Batch);
+	}
+
+	if (PendingBatches.IsEmpty())
+	{
+		TickHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void FMDFastBindingAssetPrefetcher::IssueBatch(FPrefetchBatch& Batch)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	// Already loaded assets are still requested so that the handle keeps them resident
+	TSharedPtr<FStreamableHandle> Handle;
+	if (Batch.Owner.IsValid() && !Batch.Paths.IsEmpty())
+	{
+		Handle = FMDFastBindingHelpers::GetStreamableManager().RequestAsyncLoad(MoveTemp(Batch.Paths), FStreamableDelegate(), FStreamableManager::DefaultAsyncLoadPriority);
+	}
+
+	for (FMDFastBindingOnPrefetchRequested& Callback : Batch.Callbacks)
+	{
+		Callback.ExecuteIfBound(Handle);
+	}
+}
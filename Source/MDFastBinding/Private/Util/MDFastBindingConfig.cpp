@@ -0,0 +1,7 @@
+#include "Util/MDFastBindingConfig.h"
+
+UMDFastBindingConfig::UMDFastBindingConfig()
+{
+	CategoryName = TEXT("Plugins");
+	SectionName = TEXT("Fast Binding");
+}
@@ -0,0 +1,90 @@
+#include "Util/MDFastBindingNumberTextCache.h"
+
+#include "Internationalization/Internationalization.h"
+#include "Util/MDFastBindingConfig.h"
+
+FMDFastBindingNumberTextCache& FMDFastBindingNumberTextCache::Get()
+{
+	static FMDFastBindingNumberTextCache Instance;
+	return Instance;
+}
+
+FText FMDFastBindingNumberTextCache::AsNumber(int64 Value)
+{
+	if (!IsEnabled())
+	{
+		return FText::AsNumber(Value);
+	}
+
+	if (const FText* CachedText = IntegerCache.FindAndTouch(Value))
+	{
+		return *CachedText;
+	}
+
+	FText Text = FText::AsNumber(Value);
+	IntegerCache.Add(Value, Text);
+	return Text;
+}
+
+FText FMDFastBindingNumberTextCache::AsNumber(double Value)
+{
+	// NaN never compares equal to itself so it would only ever fill the cache
+	if (!IsEnabled() || FMath::IsNaN(Value))
+	{
+		return FText::AsNumber(Value);
+	}
+
+	if (const FText* CachedText = FloatCache.FindAndTouch(Value))
+	{
+		return *CachedText;
+	}
+
+	FText Text = FText::AsNumber(Value);
+	FloatCache.Add(Value, Text);
+	return Text;
+}
+
+void FMDFastBindingNumberTextCache::Empty()
+{
+	IntegerCache.Empty(IntegerCache.Max());
+	FloatCache.Empty(FloatCache.Max());
+}
+
+void FMDFastBindingNumberTextCache::Shutdown()
+{
+	if (CultureChangedHandle.IsValid())
+	{
+		FInternationalization::Get().OnCultureChanged().Remove(CultureChangedHandle);
+		CultureChangedHandle.Reset();
+	}
+
+	IntegerCache.Empty();
+	FloatCache.Empty();
+	bIsInitialized = false;
+}
+
+bool FMDFastBindingNumberTextCache::IsEnabled()
+{
+	if (!IsInGameThread())
+	{
+		return false;
+	}
+
+	if (!bIsInitialized)
+	{
+		bIsInitialized = true;
+
+		const int32 CacheSize = GetDefault<UMDFastBindingConfig>()->GetNumberTextCacheSize();
+		IntegerCache.Empty(CacheSize);
+		FloatCache.Empty(CacheSize);
+
+		CultureChangedHandle = FInternationalization::Get().OnCultureChanged().AddRaw(this, &FMDFastBindingNumberTextCache::OnCultureChanged);
+	}
+
+	return IntegerCache.Max() > 0;
+}
+
+void FMDFastBindingNumberTextCache::OnCultureChanged()
+{
+	Empty();
+}
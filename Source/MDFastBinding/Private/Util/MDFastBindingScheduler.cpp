@@ -0,0 +1,97 @@
+#include "Util/MDFastBindingScheduler.h"
+
+#include "MDFastBindingObject.h"
+#include "Misc/App.h"
+
+FMDFastBindingScheduler& FMDFastBindingScheduler::Get()
+{
+	static FMDFastBindingScheduler Instance;
+	return Instance;
+}
+
+double FMDFastBindingScheduler::GetCurrentTime()
+{
+	return FApp::GetCurrentTime();
+}
+
+void FMDFastBindingScheduler::ScheduleWakeUp(UMDFastBindingObject* Object, double WakeTime)
+{
+	if (Object == nullptr)
+	{
+		return;
+	}
+
+	double& ScheduledTime = WakeTimes.FindOrAdd(Object, TNumericLimits<double>::Max());
+	if (ScheduledTime == WakeTime)
+	{
+		return;
+	}
+
+	ScheduledTime = WakeTime;
+	WakeUpHeap.HeapPush({ WakeTime, Object, Object });
+
+	if (!TickHandle.IsValid())
+	{
+		TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMDFastBindingScheduler::Tick));
+	}
+}
+
+void FMDFastBindingScheduler::CancelWakeUp(const UMDFastBindingObject* Object)
+{
+	WakeTimes.Remove(Object);
+}
+
+bool FMDFastBindingScheduler::IsWakeUpScheduled(const UMDFastBindingObject* Object) const
+{
+	return WakeTimes.Contains(Object);
+}
+
+void FMDFastBindingScheduler::Shutdown()
+{
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+
+	WakeUpHeap.Reset();
+	WakeTimes.Reset();
+}
+
+bool FMDFastBindingScheduler::Tick(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	const double CurrentTime = GetCurrentTime();
+
+	// Objects may schedule their next wake-up as soon as they're marked dirty, so collect everything that's due first
+	TArray<UMDFastBindingObject*, TInlineAllocator<16>> ObjectsToWake;
+	while (!WakeUpHeap.IsEmpty() && WakeUpHeap.HeapTop().WakeTime <= CurrentTime)
+	{
+		FScheduledWakeUp WakeUp;
+		WakeUpHeap.HeapPop(WakeUp);
+
+		const double* ScheduledTime = WakeTimes.Find(WakeUp.ObjectKey);
+		if (ScheduledTime != nullptr && *ScheduledTime == WakeUp.WakeTime)
+		{
+			WakeTimes.Remove(WakeUp.ObjectKey);
+			if (UMDFastBindingObject* Object = WakeUp.Object.Get())
+			{
+				ObjectsToWake.Add(Object);
+			}
+		}
+	}
+
+	for (UMDFastBindingObject* Object : ObjectsToWake)
+	{
+		Object->MarkObjectDirty();
+	}
+
+	if (WakeUpHeap.IsEmpty())
+	{
+		TickHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
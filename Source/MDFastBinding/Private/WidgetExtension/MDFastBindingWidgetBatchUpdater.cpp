@@ -0,0 +1,136 @@
+#include "WidgetExtension/MDFastBindingWidgetBatchUpdater.h"
+
+#include "MDFastBindingContainer.h"
+#include "Blueprint/UserWidget.h"
+#include "WidgetExtension/MDFastBindingWidgetExtension.h"
+
+FMDFastBindingWidgetBatchUpdater& FMDFastBindingWidgetBatchUpdater::Get()
+{
+	static FMDFastBindingWidgetBatchUpdater Instance;
+	return Instance;
+}
+
+void FMDFastBindingWidgetBatchUpdater::RegisterExtension(UMDFastBindingWidgetExtension* Extension)
+{
+	const UUserWidget* UserWidget = Extension != nullptr ? Extension->GetUserWidget() : nullptr;
+	if (UserWidget == nullptr || Extension->bIsRegisteredForBatchUpdate)
+	{
+		return;
+	}
+
+	Extension->bIsRegisteredForBatchUpdate = true;
+	PendingRegistrations.Add(Extension);
+
+	if (!TickHandle.IsValid())
+	{
+		TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMDFastBindingWidgetBatchUpdater::Tick));
+	}
+}
+
+void FMDFastBindingWidgetBatchUpdater::UnregisterExtension(UMDFastBindingWidgetExtension* Extension)
+{
+	// Removal is deferred to the next tick so extensions can unregister while a batch is being updated
+	if (Extension != nullptr)
+	{
+		Extension->bIsRegisteredForBatchUpdate = false;
+	}
+}
+
+void FMDFastBindingWidgetBatchUpdater::Shutdown()
+{
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+
+	ExtensionsByClass.Reset();
+	PendingRegistrations.Reset();
+}
+
+bool FMDFastBindingWidgetBatchUpdater::Tick(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	AddPendingRegistrations();
+
+	for (auto It = ExtensionsByClass.CreateIterator(); It; ++It)
+	{
+		TArray<TWeakObjectPtr<UMDFastBindingWidgetExtension>>& Extensions = It.Value();
+		Extensions.RemoveAllSwap([](const TWeakObjectPtr<UMDFastBindingWidgetExtension>& Extension)
+		{
+			return !Extension.IsValid() || !Extension->bIsRegisteredForBatchUpdate;
+		});
+
+		if (!It.Key().IsValid() || Extensions.IsEmpty())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		UpdateBatch(Extensions);
+	}
+
+	if (ExtensionsByClass.IsEmpty() && PendingRegistrations.IsEmpty())
+	{
+		TickHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void FMDFastBindingWidgetBatchUpdater::AddPendingRegistrations()
+{
+	for (const TWeakObjectPtr<UMDFastBindingWidgetExtension>& ExtensionPtr : PendingRegistrations)
+	{
+		const UMDFastBindingWidgetExtension* Extension = ExtensionPtr.Get();
+		const UUserWidget* UserWidget = Extension != nullptr ? Extension->GetUserWidget() : nullptr;
+		if (UserWidget != nullptr && Extension->bIsRegisteredForBatchUpdate)
+		{
+			// The extension may still be in the array if it was unregistered and registered again
+			ExtensionsByClass.FindOrAdd(UserWidget->GetClass()).AddUnique(ExtensionPtr);
+		}
+	}
+
+	PendingRegistrations.Reset();
+}
+
+void FMDFastBindingWidgetBatchUpdater::UpdateBatch(TArray<TWeakObjectPtr<UMDFastBindingWidgetExtension>>& Extensions)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__);
+
+	// Every instance of a class has the same container layout, so the first one tells us how many bindings to step through
+	const UMDFastBindingWidgetExtension* FirstExtension = Extensions[0].Get();
+	const int32 NumContainers = FirstExtension->GetNumContainers();
+	for (int32 ContainerIndex = 0; ContainerIndex < NumContainers; ++ContainerIndex)
+	{
+		const UMDFastBindingContainer* FirstContainer = FirstExtension->GetContainerAtIndex(ContainerIndex);
+		const int32 NumBindings = FirstContainer != nullptr ? FirstContainer->GetNumBindings() : 0;
+		for (int32 BindingIndex = 0; BindingIndex < NumBindings; ++BindingIndex)
+		{
+			for (const TWeakObjectPtr<UMDFastBindingWidgetExtension>& ExtensionPtr : Extensions)
+			{
+				UMDFastBindingWidgetExtension* Extension = ExtensionPtr.Get();
+				if (Extension == nullptr || !Extension->TickingContainers.IsValidIndex(ContainerIndex) || !Extension->TickingContainers[ContainerIndex])
+				{
+					continue;
+				}
+
+				UMDFastBindingContainer* Container = Extension->GetContainerAtIndex(ContainerIndex);
+				if (UUserWidget* UserWidget = Extension->GetUserWidget())
+				{
+					Container->UpdateBinding(UserWidget, BindingIndex);
+				}
+			}
+		}
+	}
+
+	for (const TWeakObjectPtr<UMDFastBindingWidgetExtension>& ExtensionPtr : Extensions)
+	{
+		if (UMDFastBindingWidgetExtension* Extension = ExtensionPtr.Get())
+		{
+			Extension->FinishBatchUpdate();
+		}
+	}
+}
@@ -74,5 +74,9 @@ void UMDFastBindingWidgetClassExtension::Construct(UUserWidget* UserWidget)
 void UMDFastBindingWidgetClassExtension::SetBindingContainer(UMDFastBindingContainer* BPBindingContainer)
 {
 	BindingContainer = DuplicateObject(BPBindingContainer, this);
+	if (BindingContainer != nullptr)
+	{
+		BindingContainer->OptimizeForRuntime();
+	}
 }
 #endif
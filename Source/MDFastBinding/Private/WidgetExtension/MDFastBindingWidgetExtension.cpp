@@ -2,16 +2,20 @@
 
 #include "MDFastBindingContainer.h"
 #include "Blueprint/UserWidget.h"
+#include "Util/MDFastBindingConfig.h"
+#include "WidgetExtension/MDFastBindingWidgetBatchUpdater.h"
 #include "Widgets/IToolTip.h"
 
 void UMDFastBindingWidgetExtension::Construct()
 {
 	Super::Construct();
 
-	TickingContainers.Insert(false, 0, SuperBindingContainers.Num() + 1);
+	TickingContainers.Insert(false, 0, GetNumContainers());
 
 	if (UUserWidget* UserWidget = GetUserWidget())
 	{
+		bIsBatchUpdating = !UserWidget->IsDesignTime() && GetDefault<UMDFastBindingConfig>()->ShouldBatchWidgetUpdates();
+
 		if (BindingContainer != nullptr)
 		{
 			BindingContainer->InitializeBindings(UserWidget);
@@ -26,6 +30,8 @@ void UMDFastBindingWidgetExtension::Construct()
 				TickingContainers[i + 1] = SuperBindingContainer->DoesNeedTick();
 			}
 		}
+
+		UpdateBatchRegistration();
 	}
 }
 
@@ -34,6 +40,7 @@ void UMDFastBindingWidgetExtension::Destruct()
 	Super::Destruct();
 
 	TickingContainers.Reset();
+	UpdateBatchRegistration();
 
 	if (UUserWidget* UserWidget = GetUserWidget())
 	{
@@ -75,7 +82,7 @@ void UMDFastBindingWidgetExtension::Tick(const FGeometry& MyGeometry, float InDe
 
 bool UMDFastBindingWidgetExtension::RequiresTick() const
 {
-	return TickingContainers.Contains(true);
+	return !bIsBatchUpdating && TickingContainers.Contains(true);
 }
 
 void UMDFastBindingWidgetExtension::UpdateBindings()
@@ -85,7 +92,7 @@ void UMDFastBindingWidgetExtension::UpdateBindings()
 		for (TConstSetBitIterator<> It(TickingContainers); It; ++It)
 		{
 			const int32 Index = It.GetIndex();
-			UMDFastBindingContainer* Container = (Index == 0) ? BindingContainer : SuperBindingContainers[Index - 1];
+			UMDFastBindingContainer* Container = GetContainerAtIndex(Index);
 			if (Container != nullptr && Container->DoesNeedTick())
 			{
 				Container->UpdateBindings(UserWidget);
@@ -95,6 +102,38 @@ void UMDFastBindingWidgetExtension::UpdateBindings()
 	}
 }
 
+UMDFastBindingContainer* UMDFastBindingWidgetExtension::GetContainerAtIndex(int32 Index) const
+{
+	return (Index == 0) ? BindingContainer.Get() : SuperBindingContainers[Index - 1].Get();
+}
+
+void UMDFastBindingWidgetExtension::FinishBatchUpdate()
+{
+	for (TConstSetBitIterator<> It(TickingContainers); It; ++It)
+	{
+		const int32 Index = It.GetIndex();
+		if (UMDFastBindingContainer* Container = GetContainerAtIndex(Index))
+		{
+			Container->FinishUpdatingBindings();
+			TickingContainers[Index] = Container->DoesNeedTick();
+		}
+	}
+
+	UpdateBatchRegistration();
+}
+
+void UMDFastBindingWidgetExtension::UpdateBatchRegistration()
+{
+	if (bIsBatchUpdating && TickingContainers.Contains(true))
+	{
+		FMDFastBindingWidgetBatchUpdater::Get().RegisterExtension(this);
+	}
+	else if (bIsRegisteredForBatchUpdate)
+	{
+		FMDFastBindingWidgetBatchUpdater::Get().UnregisterExtension(this);
+	}
+}
+
 void UMDFastBindingWidgetExtension::SetBindingContainer(const UMDFastBindingContainer* CDOBindingContainer)
 {
 	BindingContainer = DuplicateObject(CDOBindingContainer, this);
@@ -135,6 +174,8 @@ void UMDFastBindingWidgetExtension::UpdateNeedsTick()
 		}
 	}
 
+	UpdateBatchRegistration();
+
 	if (bDidNeedTick != RequiresTick())
 	{
 		if (UUserWidget* UserWidget = GetUserWidget())
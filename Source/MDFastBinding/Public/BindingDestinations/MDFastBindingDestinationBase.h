@@ -3,6 +3,7 @@
 #include "MDFastBindingObject.h"
 #include "MDFastBindingDestinationBase.generated.h"
 
+class UMDFastBindingContainer;
 class UMDFastBindingValueBase;
 
 /**
@@ -16,10 +17,15 @@ class MDFASTBINDING_API UMDFastBindingDestinationBase : public UMDFastBindingObj
 public:
 	void InitializeDestination(UObject* SourceObject);
 	void UpdateDestination(UObject* SourceObject);
+	// Applies a write that was staged by UpdateDestination, called by the container when it defers destination writes
+	void CommitDestination();
 	void TerminateDestination(UObject* SourceObject);
 
 #if WITH_EDITOR
 	bool IsActive() const;
+
+	// Called on the compiled copy of the bindings, returns a destination that performs the same work faster or null to keep this one
+	virtual UMDFastBindingDestinationBase* CreateRuntimeReplacement() { return nullptr; }
 #endif
 
 protected:
@@ -28,6 +34,13 @@ protected:
 	virtual void InitializeDestination_Internal(UObject* SourceObject) {}
 	virtual void UpdateDestination_Internal(UObject* SourceObject) {}
 	virtual void TerminateDestination_Internal(UObject* SourceObject) {}
+	virtual void CommitDestination_Internal() {}
+
+	// If true, child classes should stage their write and call QueueCommit instead of writing during UpdateDestination_Internal
+	bool ShouldDeferCommit() const;
+	void QueueCommit(UObject* TargetObject);
+
+	UMDFastBindingContainer* GetOuterContainer() const;
 
 	// Must be called manually by child classes after updated the destination
 	void MarkAsHasEverUpdated();
@@ -37,4 +50,6 @@ protected:
 private:
 	UPROPERTY(Transient)
 	bool bHasEverUpdated = false;
+
+	mutable TWeakObjectPtr<UMDFastBindingContainer> OuterContainer;
 };
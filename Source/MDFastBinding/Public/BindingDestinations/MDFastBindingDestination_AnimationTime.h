@@ -0,0 +1,55 @@
+#pragma once
+
+#include "BindingDestinations/MDFastBindingDestinationBase.h"
+#include "MDFastBindingDestination_AnimationTime.generated.h"
+
+class UUMGSequencePlayer;
+class UUserWidget;
+class UWidgetAnimation;
+
+/**
+ * Drive the playback position of a widget animation from a value.
+ * The animation is only evaluated when the time changes. Its sequence player stays active on the widget but paused between changes,
+ * and is reacquired if something else stops the animation.
+ */
+UCLASS(collapseCategories, meta = (DisplayName = "Set Animation Time"))
+class MDFASTBINDING_API UMDFastBindingDestination_AnimationTime : public UMDFastBindingDestinationBase
+{
+	GENERATED_BODY()
+
+public:
+#if WITH_EDITORONLY_DATA
+	virtual bool DoesBindingItemDefaultToSelf(const FName& InItemName) const override;
+#endif
+
+protected:
+	virtual void UpdateDestination_Internal(UObject* SourceObject) override;
+	virtual void CommitDestination_Internal() override;
+
+	virtual void SetupBindingItems() override;
+
+	// If true, Time is treated as 0-1 across the animation's length rather than in seconds
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	bool bUseNormalizedTime = false;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UUserWidget> WidgetProperty = nullptr;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UWidgetAnimation> AnimationProperty = nullptr;
+
+	UPROPERTY(Transient)
+	float TimeProperty = 0.f;
+
+private:
+	void ApplyPendingTime();
+
+	TWeakObjectPtr<UUserWidget> TargetWidget;
+	TWeakObjectPtr<UWidgetAnimation> TargetAnimation;
+	float PendingTime = 0.f;
+
+	// What was last evaluated, so unchanged times don't evaluate the sequence again
+	TWeakObjectPtr<UUserWidget> AppliedWidget;
+	TWeakObjectPtr<UUMGSequencePlayer> SequencePlayer;
+	float AppliedTime = 0.f;
+};
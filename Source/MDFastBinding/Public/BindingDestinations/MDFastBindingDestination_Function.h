@@ -49,6 +49,11 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Binding")
 	FMDFastBindingFunctionWrapper Function;
 
+	// If true, the function isn't called again when its owner and arguments are the same as the last call, useful for setters that invalidate unconditionally.
+	// Functions without parameters and the Always update type are always called.
+	UPROPERTY(EditAnywhere, Category = "Performance", meta = (EditCondition = "UpdateType != EMDFastBindingUpdateType::Always"))
+	bool bSkipCallIfArgumentsUnchanged = false;
+
 private:
 	UPROPERTY(Transient)
 	UObject* ObjectProperty = nullptr;
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "BindingDestinations/MDFastBindingDestination_NativeWidget.h"
+#include "MDFastBindingDestination_ImageBrush.generated.h"
+
+/**
+ * Set the brush of an Image by calling UImage::SetBrush directly
+ */
+UCLASS(collapseCategories, meta = (DisplayName = "Set Image Brush"))
+class MDFASTBINDING_API UMDFastBindingDestination_ImageBrush : public UMDFastBindingDestination_NativeWidget
+{
+	GENERATED_BODY()
+
+public:
+	virtual TSubclassOf<UWidget> GetWidgetClass() const override;
+	virtual FName GetWidgetPropertyName() const override;
+
+protected:
+	virtual void ApplyValue(UWidget& Widget, const void* ValuePtr) const override;
+};
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "BindingDestinations/MDFastBindingDestination_NativeWidget.h"
+#include "MDFastBindingDestination_ImageColor.generated.h"
+
+/**
+ * Set the color and opacity of an Image by calling UImage::SetColorAndOpacity directly
+ */
+UCLASS(collapseCategories, meta = (DisplayName = "Set Image Color and Opacity"))
+class MDFASTBINDING_API UMDFastBindingDestination_ImageColor : public UMDFastBindingDestination_NativeWidget
+{
+	GENERATED_BODY()
+
+public:
+	virtual TSubclassOf<UWidget> GetWidgetClass() const override;
+	virtual FName GetWidgetPropertyName() const override;
+
+protected:
+	virtual void ApplyValue(UWidget& Widget, const void* ValuePtr) const override;
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "BindingDestinations/MDFastBindingDestinationBase.h"
+#include "MDFastBindingDestination_MaterialParameters.generated.h"
+
+class UImage;
+class UMaterialInstanceDynamic;
+class UTexture;
+
+UENUM()
+enum class EMDFastBindingMaterialParameterType : uint8
+{
+	Scalar,
+	Vector,
+	Texture
+};
+
+USTRUCT()
+struct MDFASTBINDING_API FMDFastBindingMaterialParameter
+{
+	GENERATED_BODY()
+
+public:
+	// Name of the material parameter, also used as the name of its input pin
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	FName ParameterName = NAME_None;
+
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	EMDFastBindingMaterialParameterType ParameterType = EMDFastBindingMaterialParameterType::Scalar;
+};
+
+/**
+ * Set several parameters on the dynamic material of an Image's brush.
+ * Parameter indices are cached and only the parameters that changed are applied, together, once per update.
+ */
+UCLASS(collapseCategories, meta = (DisplayName = "Set Material Parameters"))
+class MDFASTBINDING_API UMDFastBindingDestination_MaterialParameters : public UMDFastBindingDestinationBase
+{
+	GENERATED_BODY()
+
+public:
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+#endif
+
+protected:
+	virtual void InitializeDestination_Internal(UObject* SourceObject) override;
+	virtual void UpdateDestination_Internal(UObject* SourceObject) override;
+	virtual void CommitDestination_Internal() override;
+
+	virtual void SetupBindingItems() override;
+
+	// The parameters to set, each one gets an input pin
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	TArray<FMDFastBindingMaterialParameter> Parameters;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UImage> ImageProperty = nullptr;
+
+	UPROPERTY(Transient)
+	float ScalarProperty = 0.f;
+
+	UPROPERTY(Transient)
+	FLinearColor VectorProperty = FLinearColor::Black;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UTexture> TextureProperty = nullptr;
+
+private:
+	struct FParameterState
+	{
+		// Index into the dynamic material's parameter arrays, only used by scalar and vector parameters
+		int32 ParameterIndex = INDEX_NONE;
+		bool bIsInitialized = false;
+
+		float ScalarValue = 0.f;
+		FLinearColor VectorValue = FLinearColor::Black;
+		TWeakObjectPtr<UTexture> TextureValue;
+	};
+
+	const FProperty* GetParameterTypeProperty(EMDFastBindingMaterialParameterType ParameterType) const;
+
+	void ApplyPendingParameters();
+
+	void ResetParameterStates();
+
+	TWeakObjectPtr<UImage> TargetImage;
+	TWeakObjectPtr<UMaterialInstanceDynamic> TargetMaterial;
+
+	// Aligned with Parameters
+	TArray<FParameterState> ParameterStates;
+
+	// Indices into Parameters whose new values are waiting to be applied
+	TArray<int32> PendingParameters;
+};
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "BindingDestinations/MDFastBindingDestinationBase.h"
+#include "Templates/SubclassOf.h"
+#include "MDFastBindingDestination_NativeWidget.generated.h"
+
+class SWidget;
+class UMDFastBindingDestination_Property;
+class UWidget;
+
+/**
+ * Base class for destinations that write a single, well-known widget property by calling its native setter directly,
+ * skipping the field path resolution and setter dispatch of UMDFastBindingDestination_Property.
+ * Property destinations that match one of these are swapped out when the widget blueprint is compiled.
+ */
+UCLASS(Abstract, collapseCategories)
+class MDFASTBINDING_API UMDFastBindingDestination_NativeWidget : public UMDFastBindingDestinationBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BeginDestroy() override;
+
+	// The widget class that owns the property this destination writes to
+	virtual TSubclassOf<UWidget> GetWidgetClass() const { return nullptr; }
+	// The name of the property on GetWidgetClass() that this destination writes to.
+	// Direct access to most UMG properties is deprecated, so overrides return a name literal rather than using GET_MEMBER_NAME_CHECKED, which would warn.
+	virtual FName GetWidgetPropertyName() const { return NAME_None; }
+
+	const FProperty* GetWidgetProperty() const;
+
+	// Whether property destinations that write to GetWidgetProperty() can be swapped for this class when compiling
+	virtual bool CanReplacePropertyDestination() const { return true; }
+
+#if WITH_EDITORONLY_DATA
+	virtual bool DoesBindingItemDefaultToSelf(const FName& InItemName) const override;
+#endif
+
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+
+	// Finds the native destination class that writes to WidgetProperty, if there is one
+	static TSubclassOf<UMDFastBindingDestination_NativeWidget> FindClassForWidgetProperty(const FProperty* WidgetProperty);
+
+	// Creates a native destination that performs the same write as PropertyDestination, returns null if the property destination's path doesn't match one
+	static UMDFastBindingDestination_NativeWidget* CreateFromPropertyDestination(UMDFastBindingDestination_Property& PropertyDestination);
+#endif
+
+protected:
+	virtual void InitializeDestination_Internal(UObject* SourceObject) override;
+	virtual void UpdateDestination_Internal(UObject* SourceObject) override;
+	virtual void CommitDestination_Internal() override;
+
+	virtual void SetupBindingItems() override;
+
+	// Calls the native setter on Widget, which is guaranteed to be a GetWidgetClass(), ValuePtr points to a value of GetWidgetProperty()'s type
+	virtual void ApplyValue(UWidget& Widget, const void* ValuePtr) const {}
+
+	// Returns the Slate widget built by Widget if it has been built and its type is SlateTypeName, null otherwise
+	static SWidget* FindSlateWidgetOfType(const UWidget& Widget, const FName& SlateTypeName);
+
+	// Copies ValuePtr into the widget's property memory without calling its setter, to keep the UMG property in sync when writing to Slate directly
+	void CopyToWidgetProperty(UWidget& Widget, const void* ValuePtr) const;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UWidget> WidgetProperty = nullptr;
+
+	// If true, the setter isn't called again when the widget and the value are the same as the last call, useful for setters that invalidate unconditionally.
+	// The Always update type always calls the setter, eg. to restore a value that was changed elsewhere.
+	UPROPERTY(EditAnywhere, Category = "Performance", meta = (EditCondition = "UpdateType != EMDFastBindingUpdateType::Always"))
+	bool bSkipApplyIfValueUnchanged = false;
+
+private:
+	void ApplyPendingValue(UWidget* Widget);
+
+	void AllocateValues();
+	void FreeValues();
+
+	TWeakObjectPtr<UWidget> TargetWidget;
+
+	const FProperty* ValueProperty = nullptr;
+
+	// The incoming value, converted to the widget property's type
+	void* PendingValue = nullptr;
+
+	// Shadow copy of the last value applied to AppliedWidget so redundant setter calls can be skipped
+	void* AppliedValue = nullptr;
+	TWeakObjectPtr<UWidget> AppliedWidget;
+	bool bHasAppliedValue = false;
+};
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "BindingDestinations/MDFastBindingDestination_NativeWidget.h"
+#include "MDFastBindingDestination_ProgressBarPercent.generated.h"
+
+/**
+ * Set the fill percent of a Progress Bar by calling UProgressBar::SetPercent directly
+ */
+UCLASS(collapseCategories, meta = (DisplayName = "Set Progress Bar Percent"))
+class MDFASTBINDING_API UMDFastBindingDestination_ProgressBarPercent : public UMDFastBindingDestination_NativeWidget
+{
+	GENERATED_BODY()
+
+public:
+	virtual TSubclassOf<UWidget> GetWidgetClass() const override;
+	virtual FName GetWidgetPropertyName() const override;
+
+protected:
+	virtual void ApplyValue(UWidget& Widget, const void* ValuePtr) const override;
+};
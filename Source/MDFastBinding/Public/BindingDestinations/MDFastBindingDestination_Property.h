@@ -15,6 +15,8 @@ class MDFASTBINDING_API UMDFastBindingDestination_Property : public UMDFastBindi
 public:
 	UMDFastBindingDestination_Property();
 
+	virtual void BeginDestroy() override;
+
 #if WITH_EDITOR
 	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
 
@@ -22,6 +24,13 @@ public:
 
 	void SetFieldPath(const TArray<FFieldVariant>& Path);
 	TArray<FFieldVariant> GetFieldPath();
+
+	const FMDFastBindingItem* GetPathRootItem() const;
+	const FMDFastBindingItem* GetValueSourceItem() const;
+
+	bool ShouldSkipWriteIfValueUnchanged() const { return bSkipWriteIfValueUnchanged; }
+
+	virtual UMDFastBindingDestinationBase* CreateRuntimeReplacement() override;
 #endif
 
 #if WITH_EDITORONLY_DATA
@@ -33,9 +42,13 @@ public:
 protected:
 	virtual void InitializeDestination_Internal(UObject* SourceObject) override;
 	virtual void UpdateDestination_Internal(UObject* SourceObject) override;
+	virtual void CommitDestination_Internal() override;
+	virtual void TerminateDestination_Internal(UObject* SourceObject) override;
 
 	virtual void PostInitProperties() override;
 
+	void SetDestinationValue(UObject* RootObject, const TTuple<const FProperty*, void*>& Value);
+
 	virtual UObject* GetPropertyOwner(UObject* SourceObject);
 	virtual UStruct* GetPropertyOwnerStruct();
 
@@ -51,5 +64,30 @@ protected:
 	UPROPERTY(Transient)
 	bool bNeedsUpdate = false;
 
+	// If true, the property isn't written again when its owner and the value are the same as the last write, skipping setters that invalidate unconditionally.
+	// The Always update type always writes, eg. to restore a property that was changed elsewhere.
+	UPROPERTY(EditAnywhere, Category = "Performance", meta = (EditCondition = "UpdateType != EMDFastBindingUpdateType::Always"))
+	bool bSkipWriteIfValueUnchanged = false;
+
 	UE::FieldNotification::FFieldId BoundFieldId;
+
+private:
+	bool ShouldSkipUnchangedWrites() const;
+
+	// The value and owner gathered during update, waiting for the container to commit them
+	TWeakObjectPtr<UObject> StagedRootObject;
+	TTuple<const FProperty*, void*> StagedValue;
+
+	// Shadow copy of the last value written and where it was written to, so redundant writes (and their setters) can be skipped
+	bool IsIdenticalToLastWrittenValue(const void* PropertyContainer, const TTuple<const FProperty*, void*>& Value) const;
+	void StoreLastWrittenValue(void* PropertyContainer, const TTuple<const FProperty*, void*>& Value);
+	void FreeLastWrittenValue();
+
+	// Text converted from other types (eg. numbers) is culture dependent, so it's rewritten when the culture changes
+	void OnCultureChanged();
+
+	FDelegateHandle CultureChangedHandle;
+
+	TTuple<const FProperty*, void*> LastWrittenValue;
+	const void* LastWrittenContainer = nullptr;
 };
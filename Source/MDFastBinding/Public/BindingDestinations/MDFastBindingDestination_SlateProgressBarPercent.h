@@ -0,0 +1,21 @@
+#pragma once
+
+#include "BindingDestinations/MDFastBindingDestination_ProgressBarPercent.h"
+#include "MDFastBindingDestination_SlateProgressBarPercent.generated.h"
+
+/**
+ * Set the fill percent of a Progress Bar's SProgressBar directly, bypassing the UMG setter.
+ * The UMG property is still copied to so a rebuilt Slate widget picks up the latest value, but its setter and any FieldNotify broadcast are skipped.
+ */
+UCLASS(collapseCategories, meta = (DisplayName = "Set Progress Bar Percent (Slate)"))
+class MDFASTBINDING_API UMDFastBindingDestination_SlateProgressBarPercent : public UMDFastBindingDestination_ProgressBarPercent
+{
+	GENERATED_BODY()
+
+public:
+	// Opt-in only since FieldNotify listeners on the UMG property won't be notified
+	virtual bool CanReplacePropertyDestination() const override { return false; }
+
+protected:
+	virtual void ApplyValue(UWidget& Widget, const void* ValuePtr) const override;
+};
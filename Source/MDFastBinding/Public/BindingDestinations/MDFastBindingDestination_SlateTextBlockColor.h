@@ -0,0 +1,21 @@
+#pragma once
+
+#include "BindingDestinations/MDFastBindingDestination_TextBlockColor.h"
+#include "MDFastBindingDestination_SlateTextBlockColor.generated.h"
+
+/**
+ * Set the color and opacity of a Text Block's STextBlock directly, bypassing the UMG setter.
+ * The UMG property is still copied to so a rebuilt Slate widget picks up the latest value, but its setter and any FieldNotify broadcast are skipped.
+ */
+UCLASS(collapseCategories, meta = (DisplayName = "Set Text Block Color and Opacity (Slate)"))
+class MDFASTBINDING_API UMDFastBindingDestination_SlateTextBlockColor : public UMDFastBindingDestination_TextBlockColor
+{
+	GENERATED_BODY()
+
+public:
+	// Opt-in only since FieldNotify listeners on the UMG property won't be notified
+	virtual bool CanReplacePropertyDestination() const override { return false; }
+
+protected:
+	virtual void ApplyValue(UWidget& Widget, const void* ValuePtr) const override;
+};
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "BindingDestinations/MDFastBindingDestination_NativeWidget.h"
+#include "MDFastBindingDestination_TextBlockColor.generated.h"
+
+/**
+ * Set the color and opacity of a Text Block by calling UTextBlock::SetColorAndOpacity directly
+ */
+UCLASS(collapseCategories, meta = (DisplayName = "Set Text Block Color and Opacity"))
+class MDFASTBINDING_API UMDFastBindingDestination_TextBlockColor : public UMDFastBindingDestination_NativeWidget
+{
+	GENERATED_BODY()
+
+public:
+	virtual TSubclassOf<UWidget> GetWidgetClass() const override;
+	virtual FName GetWidgetPropertyName() const override;
+
+protected:
+	virtual void ApplyValue(UWidget& Widget, const void* ValuePtr) const override;
+};
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "BindingDestinations/MDFastBindingDestination_NativeWidget.h"
+#include "MDFastBindingDestination_TextBlockText.generated.h"
+
+/**
+ * Set the text of a Text Block by calling UTextBlock::SetText directly
+ */
+UCLASS(collapseCategories, meta = (DisplayName = "Set Text Block Text"))
+class MDFASTBINDING_API UMDFastBindingDestination_TextBlockText : public UMDFastBindingDestination_NativeWidget
+{
+	GENERATED_BODY()
+
+public:
+	virtual TSubclassOf<UWidget> GetWidgetClass() const override;
+	virtual FName GetWidgetPropertyName() const override;
+
+protected:
+	virtual void ApplyValue(UWidget& Widget, const void* ValuePtr) const override;
+};
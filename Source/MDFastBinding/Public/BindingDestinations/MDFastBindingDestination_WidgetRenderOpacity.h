@@ -0,0 +1,20 @@
+#pragma once
+
+#include "BindingDestinations/MDFastBindingDestination_NativeWidget.h"
+#include "MDFastBindingDestination_WidgetRenderOpacity.generated.h"
+
+/**
+ * Set the render opacity of a Widget by calling UWidget::SetRenderOpacity directly
+ */
+UCLASS(collapseCategories, meta = (DisplayName = "Set Widget Render Opacity"))
+class MDFASTBINDING_API UMDFastBindingDestination_WidgetRenderOpacity : public UMDFastBindingDestination_NativeWidget
+{
+	GENERATED_BODY()
+
+public:
+	virtual TSubclassOf<UWidget> GetWidgetClass() const override;
+	virtual FName GetWidgetPropertyName() const override;
+
+protected:
+	virtual void ApplyValue(UWidget& Widget, const void* ValuePtr) const override;
+};
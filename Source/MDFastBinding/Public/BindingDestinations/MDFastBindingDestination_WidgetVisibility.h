@@ -0,0 +1,20 @@
+#pragma once
+
+#include "BindingDestinations/MDFastBindingDestination_NativeWidget.h"
+#include "MDFastBindingDestination_WidgetVisibility.generated.h"
+
+/**
+ * Set the visibility of a Widget by calling UWidget::SetVisibility directly
+ */
+UCLASS(collapseCategories, meta = (DisplayName = "Set Widget Visibility"))
+class MDFASTBINDING_API UMDFastBindingDestination_WidgetVisibility : public UMDFastBindingDestination_NativeWidget
+{
+	GENERATED_BODY()
+
+public:
+	virtual TSubclassOf<UWidget> GetWidgetClass() const override;
+	virtual FName GetWidgetPropertyName() const override;
+
+protected:
+	virtual void ApplyValue(UWidget& Widget, const void* ValuePtr) const override;
+};
@@ -31,6 +31,8 @@ public:
 protected:
 	virtual bool CheckNeedsUpdate() const override;
 
+	bool HasCachedValue() const { return CachedValue.Value != nullptr; }
+
 	virtual void InitializeValue_Internal(UObject* SourceObject) {}
 	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) { PURE_VIRTUAL(UMDFastBindingValueBase::GetValue, return {};) }
 	virtual void TerminateValue_Internal(UObject* SourceObject) {}
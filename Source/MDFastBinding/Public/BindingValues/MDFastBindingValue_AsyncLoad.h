@@ -0,0 +1,48 @@
+#pragma once
+
+#include "MDFastBindingValueBase.h"
+#include "UObject/SoftObjectPath.h"
+#include "MDFastBindingValue_AsyncLoad.generated.h"
+
+struct FStreamableHandle;
+
+/**
+ * Asynchronously loads a soft object reference, outputting the Placeholder until the load completes.
+ * Completion marks the binding dirty rather than polling.
+ */
+UCLASS(meta = (DisplayName = "Async Load Asset"))
+class MDFASTBINDING_API UMDFastBindingValue_AsyncLoad : public UMDFastBindingValueBase
+{
+	GENERATED_BODY()
+
+public:
+	UMDFastBindingValue_AsyncLoad();
+
+	virtual const FProperty* GetOutputProperty() override;
+
+protected:
+	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+	virtual void TerminateValue_Internal(UObject* SourceObject) override;
+	virtual void SetupBindingItems() override;
+
+	// Higher priority loads are serviced first by the streaming system
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	int32 LoadPriority = 0;
+
+private:
+	void RequestLoad(const FSoftObjectPath& Path);
+	void CancelLoad();
+
+	void OnLoadCompleted();
+
+	UPROPERTY(Transient)
+	TSoftObjectPtr<UObject> SoftObjectProperty;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UObject> ObjectProperty;
+
+	FSoftObjectPath RequestedPath;
+
+	// Kept until the path changes so the loaded asset stays resident while it's being displayed
+	TSharedPtr<FStreamableHandle> LoadHandle;
+};
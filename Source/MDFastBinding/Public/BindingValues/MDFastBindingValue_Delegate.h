@@ -0,0 +1,45 @@
+#pragma once
+
+#include "MDFastBindingValue_Property.h"
+#include "MDFastBindingValue_Delegate.generated.h"
+
+/**
+ * Retrieve the value of a property or const function each time a multicast delegate (eg. OnHealthChanged) on the path root is broadcast
+ */
+UCLASS(meta = (DisplayName = "Read a Property on Event"))
+class MDFASTBINDING_API UMDFastBindingValue_Delegate : public UMDFastBindingValue_Property
+{
+	GENERATED_BODY()
+
+public:
+	UMDFastBindingValue_Delegate();
+
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+#endif
+
+protected:
+	virtual void InitializeValue_Internal(UObject* SourceObject) override;
+	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+	virtual void TerminateValue_Internal(UObject* SourceObject) override;
+
+	// Bound to the delegate regardless of its signature, the broadcast's parameters are ignored
+	UFUNCTION()
+	void OnDelegateBroadcast();
+
+	UFUNCTION()
+	TArray<FName> GetDelegatePropertyNames();
+
+	const FMulticastDelegateProperty* GetDelegateProperty();
+
+	void BindDelegate(UObject* SourceObject);
+	void UnbindDelegate();
+
+	// The multicast delegate on the path root that signals the value has changed
+	UPROPERTY(EditAnywhere, Category = "Binding", meta = (GetOptions = "GetDelegatePropertyNames"))
+	FName DelegatePropertyName = NAME_None;
+
+private:
+	TWeakObjectPtr<UObject> BoundObject;
+	TWeakFieldPtr<const FMulticastDelegateProperty> BoundDelegateProperty;
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "MDFastBindingValueBase.h"
+#include "MDFastBindingValue_Expression.generated.h"
+
+enum class EMDFastBindingExpressionOp : uint8
+{
+	Add,
+	Subtract,
+	Multiply,
+	Divide,
+	Modulo,
+	Negate,
+	Not,
+	Less,
+	LessOrEqual,
+	Greater,
+	GreaterOrEqual,
+	Equal,
+	NotEqual,
+	And,
+	Or,
+	Select,
+	Min,
+	Max,
+	Clamp,
+	Abs,
+	Floor,
+	Ceil,
+	Round,
+	Sqrt,
+	Pow,
+	Lerp
+};
+
+// A single step of a compiled expression, operands and result are indices into the register array
+USTRUCT()
+struct MDFASTBINDING_API FMDFastBindingExpressionInstruction
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	uint8 Op = 0;
+
+	UPROPERTY()
+	uint8 Result = 0;
+
+	UPROPERTY()
+	uint8 A = 0;
+
+	UPROPERTY()
+	uint8 B = 0;
+
+	UPROPERTY()
+	uint8 C = 0;
+};
+
+USTRUCT()
+struct MDFASTBINDING_API FMDFastBindingExpressionInput
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	FName Name = NAME_None;
+
+	UPROPERTY()
+	bool bIsBool = false;
+};
+
+/**
+ * Evaluates a math or logic expression, each identifier in the expression becomes an input pin.
+ * The expression is compiled in the editor into a small register program that is saved with the binding.
+ * Supports + - * / %, comparisons, == !=, && || !, ternary (Condition ? A : B), true, false
+ * and the functions min, max, clamp, abs, floor, ceil, round, sqrt, pow and lerp.
+ */
+UCLASS(meta = (DisplayName = "Expression"))
+class MDFASTBINDING_API UMDFastBindingValue_Expression : public UMDFastBindingValueBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual const FProperty* GetOutputProperty() override;
+
+#if WITH_EDITORONLY_DATA
+	virtual FText GetDisplayName() override;
+#endif
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+#endif
+
+protected:
+	virtual void InitializeValue_Internal(UObject* SourceObject) override;
+	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+	virtual void SetupBindingItems() override;
+
+	// eg. clamp(Current / Max * 100, 0, 100)
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	FString Expression = TEXT("A + B");
+
+private:
+#if WITH_EDITOR
+	// Returns false and leaves the previously compiled program's inputs in place if the expression has errors
+	bool CompileExpression(FText& OutError);
+#endif
+
+	void Execute();
+
+	double ReadInput(const FProperty* InputProp, const void* InputValuePtr) const;
+
+	UPROPERTY()
+	TArray<FMDFastBindingExpressionInput> Inputs;
+
+	UPROPERTY()
+	TArray<double> Constants;
+
+	UPROPERTY()
+	TArray<FMDFastBindingExpressionInstruction> Instructions;
+
+	UPROPERTY()
+	int32 NumRegisters = 0;
+
+	UPROPERTY()
+	int32 ResultRegister = 0;
+
+	UPROPERTY()
+	bool bReturnsBool = false;
+
+	UPROPERTY(Transient)
+	double NumberValue = 0.0;
+
+	UPROPERTY(Transient)
+	bool BoolValue = false;
+
+	// Inputs first, then constants, then intermediate results
+	TArray<double> Registers;
+
+	bool bHasEvaluated = false;
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "MDFastBindingValueBase.h"
+#include "MDFastBindingValue_Filter.generated.h"
+
+UENUM()
+enum class EMDFastBindingFilterMode : uint8
+{
+	// The output follows the input once it moves further than Threshold from the current output
+	Deadband,
+	// The output is the input rounded to the nearest multiple of Step
+	Quantize
+};
+
+/**
+ * Holds its output steady while a numeric input jitters, so nodes and destinations downstream only update on meaningful changes
+ */
+UCLASS(meta = (DisplayName = "Filter"))
+class MDFASTBINDING_API UMDFastBindingValue_Filter : public UMDFastBindingValueBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual const FProperty* GetOutputProperty() override;
+
+#if WITH_EDITORONLY_DATA
+	virtual FText GetDisplayName() override;
+#endif
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+#endif
+
+protected:
+	virtual void InitializeValue_Internal(UObject* SourceObject) override;
+	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+	virtual void SetupBindingItems() override;
+
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	EMDFastBindingFilterMode FilterMode = EMDFastBindingFilterMode::Deadband;
+
+	UPROPERTY(EditAnywhere, Category = "Binding", meta = (ClampMin = "0", EditCondition = "FilterMode == EMDFastBindingFilterMode::Deadband", EditConditionHides))
+	double Threshold = 0.01;
+
+	UPROPERTY(EditAnywhere, Category = "Binding", meta = (ClampMin = "0", EditCondition = "FilterMode == EMDFastBindingFilterMode::Quantize", EditConditionHides))
+	double Step = 1.0;
+
+	// How far past the halfway point between steps the input must move before the output switches steps, stops the output flickering when the input hovers on a boundary
+	UPROPERTY(EditAnywhere, Category = "Binding", meta = (ClampMin = "0", EditCondition = "FilterMode == EMDFastBindingFilterMode::Quantize", EditConditionHides))
+	double Hysteresis = 0.0;
+
+private:
+	void ApplyFilter(double InputValue);
+
+	UPROPERTY(Transient)
+	double OutputValue = 0.0;
+
+	UPROPERTY(Transient)
+	double ValueInput = 0.0;
+
+	bool bHasOutput = false;
+};
@@ -4,7 +4,8 @@
 #include "MDFastBindingValue_FormatText.generated.h"
 
 /**
- * Formats text based on the input format string and inputs
+ * Formats text based on the input format string and inputs.
+ * Re-formats when the culture changes, so an update type of Always behaves the same as If Updates Needed.
  */
 UCLASS(meta = (DisplayName = "Format Text"))
 class MDFASTBINDING_API UMDFastBindingValue_FormatText : public UMDFastBindingValueBase
@@ -14,18 +15,31 @@ class MDFASTBINDING_API UMDFastBindingValue_FormatText : public UMDFastBindingVa
 public:
 	virtual const FProperty* GetOutputProperty() override;
 
+	virtual EMDFastBindingUpdateType GetEffectiveUpdateType() const override;
+
 #if WITH_EDITORONLY_DATA
 	virtual FText GetDisplayName() override;
 #endif
+#if WITH_EDITOR
+	virtual bool CanBindingItemAcceptValue(const FMDFastBindingItem& BindingItem, const FProperty* ValueProp) const override;
+#endif
 
 protected:
+	virtual void InitializeValue_Internal(UObject* SourceObject) override;
 	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+	virtual void TerminateValue_Internal(UObject* SourceObject) override;
 	virtual void SetupBindingItems() override;
 
 	UPROPERTY(EditAnywhere, Category = "Binding")
 	FText FormatText = INVTEXT("{InputString}");
 
 private:
+	void CompileFormat();
+
+	void UpdateArgument(int32 ArgumentIndex, const FProperty* ArgProp, const void* ArgValuePtr);
+
+	void OnCultureChanged();
+
 	FTextFormat TextFormat;
 
 	UPROPERTY(Transient)
@@ -36,5 +50,19 @@ private:
 
 	const FProperty* TextProp = nullptr;
 
+	// The FormatText that the slots were compiled from
+	FText CompiledFormatText;
+	bool bIsFormatCompiled = false;
+
+	// Numbers have to be passed as numbers for modifiers like plural and ordinal, otherwise they're passed as cached text
+	bool bHasArgumentModifiers = false;
+
+	// Ordered to match Arguments
+	TArray<int32> ArgumentItemIndices;
+	TArray<FFormatArgumentValue*> ArgumentSlots;
+
+	// Built once when compiling, values are written through ArgumentSlots so the keys are never rebuilt
 	FFormatNamedArguments Args;
+
+	FDelegateHandle CultureChangedHandle;
 };
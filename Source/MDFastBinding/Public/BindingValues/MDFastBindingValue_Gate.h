@@ -0,0 +1,39 @@
+#pragma once
+
+#include "MDFastBindingValueBase.h"
+#include "MDFastBindingValue_Gate.generated.h"
+
+/**
+ * Passes through Value while Condition is true. While false, the nodes connected to Value are neither updated nor checked for changes.
+ */
+UCLASS(meta = (DisplayName = "Gate"))
+class MDFASTBINDING_API UMDFastBindingValue_Gate : public UMDFastBindingValueBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual const FProperty* GetOutputProperty() override;
+
+protected:
+	virtual void InitializeValue_Internal(UObject* SourceObject) override;
+	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+	virtual bool IsBindingItemRelevantToUpdate(int32 ItemIndex) const override;
+	virtual void SetupBindingItems() override;
+
+	// If true, the last value that passed through is output while closed, otherwise the Closed Value pin is output
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	bool bHoldLastValue = true;
+
+private:
+	const FProperty* ResolveOutputProperty();
+
+	UPROPERTY(Transient)
+	bool ConditionProperty = false;
+
+	TWeakFieldPtr<const FProperty> ResolvedOutputProperty;
+
+	// Points at the cached value of the node connected to Value, which stays put while the gate is closed
+	TTuple<const FProperty*, void*> LastValue;
+
+	bool bIsOpen = false;
+};
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "MDFastBindingValueBase.h"
+#include "MDFastBindingValue_Interp.generated.h"
+
+UENUM()
+enum class EMDFastBindingInterpMode : uint8
+{
+	// Eases towards the target, moving faster the further away it is
+	InterpTo UMETA(DisplayName = "Interp To"),
+	// Springs towards the target, overshooting if under damped
+	Spring,
+	// Moves towards the target at a fixed rate
+	ConstantSpeed UMETA(DisplayName = "Constant Speed")
+};
+
+/**
+ * Smoothly moves its output towards the Target input each frame using the world's delta time.
+ * Once the output reaches the target, the node stops requesting updates until the target changes.
+ */
+UCLASS(meta = (DisplayName = "Interpolate"))
+class MDFASTBINDING_API UMDFastBindingValue_Interp : public UMDFastBindingValueBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual const FProperty* GetOutputProperty() override;
+
+#if WITH_EDITORONLY_DATA
+	virtual FText GetDisplayName() override;
+#endif
+
+protected:
+	virtual bool CheckNeedsUpdate() const override;
+
+	virtual void InitializeValue_Internal(UObject* SourceObject) override;
+	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+	virtual void SetupBindingItems() override;
+
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	EMDFastBindingInterpMode InterpMode = EMDFastBindingInterpMode::InterpTo;
+
+	// For Interp To, how quickly the output eases towards the target. For Constant Speed, the units per second the output moves.
+	UPROPERTY(EditAnywhere, Category = "Binding", meta = (ClampMin = "0", EditCondition = "InterpMode != EMDFastBindingInterpMode::Spring", EditConditionHides))
+	float Speed = 5.f;
+
+	UPROPERTY(EditAnywhere, Category = "Binding", meta = (ClampMin = "0", EditCondition = "InterpMode == EMDFastBindingInterpMode::Spring", EditConditionHides))
+	float SpringStiffness = 100.f;
+
+	// 1 is critically damped, lower values overshoot the target, higher values approach it more slowly
+	UPROPERTY(EditAnywhere, Category = "Binding", meta = (ClampMin = "0", EditCondition = "InterpMode == EMDFastBindingInterpMode::Spring", EditConditionHides))
+	float SpringDampingRatio = 1.f;
+
+	// The output snaps to the target once it is within this distance, after which the node goes idle
+	UPROPERTY(EditAnywhere, Category = "Binding", meta = (ClampMin = "0"))
+	float Tolerance = 0.001f;
+
+	// If true, the first value output is the target instead of interpolating up from 0
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	bool bSnapToInitialTarget = true;
+
+private:
+	void Step(float DeltaTime);
+
+	UPROPERTY(Transient)
+	double OutputValue = 0.0;
+
+	UPROPERTY(Transient)
+	double TargetValue = 0.0;
+
+	double Velocity = 0.0;
+
+	bool bIsAtTarget = false;
+
+	bool bHasTarget = false;
+};
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "MDFastBindingValueBase.h"
+#include "MDFastBindingValue_Math.generated.h"
+
+UENUM()
+enum class EMDFastBindingMathOperation : uint8
+{
+	Add,
+	Subtract,
+	Multiply,
+	Divide,
+	Min,
+	Max,
+	Clamp,
+	Lerp,
+	MapRange UMETA(DisplayName = "Map Range"),
+	// Vectors are scaled to a length of 1, colors so their brightest channel is 1, and numbers return their sign
+	Normalize,
+	// Comparisons output a bool and must stay at the end of the enum, Vectors and Linear Colors are ordered by their length
+	Less UMETA(DisplayName = "<"),
+	LessOrEqual UMETA(DisplayName = "<="),
+	Greater UMETA(DisplayName = ">"),
+	GreaterOrEqual UMETA(DisplayName = ">="),
+	Equal UMETA(DisplayName = "=="),
+	NotEqual UMETA(DisplayName = "!=")
+};
+
+UENUM()
+enum class EMDFastBindingMathType : uint8
+{
+	Integer,
+	Float,
+	Double,
+	Vector,
+	LinearColor UMETA(DisplayName = "Linear Color")
+};
+
+/**
+ * Performs arithmetic, interpolation or comparison natively on Integer, Float, Double, Vector or Linear Color inputs
+ */
+UCLASS(meta = (DisplayName = "Math"))
+class MDFASTBINDING_API UMDFastBindingValue_Math : public UMDFastBindingValueBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual const FProperty* GetOutputProperty() override;
+
+#if WITH_EDITORONLY_DATA
+	virtual FText GetDisplayName() override;
+#endif
+
+protected:
+	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+	virtual void SetupBindingItems() override;
+
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	EMDFastBindingMathOperation Operation = EMDFastBindingMathOperation::Add;
+
+	// The type the inputs are converted to and the operation is performed on
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	EMDFastBindingMathType ValueType = EMDFastBindingMathType::Float;
+
+private:
+	bool IsComparison() const;
+
+	const FProperty* GetValueTypeProperty() const;
+	TConstArrayView<FName> GetOperandNames() const;
+
+	template<typename T>
+	bool ReadOperand(UObject* SourceObject, const FName& ItemName, const FProperty* OperandProp, T& OutValue);
+
+	template<typename T>
+	void Evaluate(UObject* SourceObject, T& OutValue);
+
+	UPROPERTY(Transient)
+	int32 IntValue = 0;
+
+	UPROPERTY(Transient)
+	float FloatValue = 0.f;
+
+	UPROPERTY(Transient)
+	double DoubleValue = 0.0;
+
+	UPROPERTY(Transient)
+	FVector VectorValue = FVector::ZeroVector;
+
+	UPROPERTY(Transient)
+	FLinearColor LinearColorValue = FLinearColor::Black;
+
+	UPROPERTY(Transient)
+	bool BoolValue = false;
+
+	// Typed pin for Lerp's alpha, regardless of ValueType
+	UPROPERTY(Transient)
+	double AlphaValue = 0.0;
+
+	const FProperty* OutputProp = nullptr;
+};
@@ -3,6 +3,18 @@
 #include "MDFastBindingValueBase.h"
 #include "MDFastBindingValue_Select.generated.h"
 
+struct FStreamableHandle;
+
+UENUM()
+enum class EMDFastBindingSelectPrefetchMode : uint8
+{
+	None,
+	// Start loading every soft result when the binding initializes, the assets can still be unloaded if unused
+	Prefetch,
+	// Load every soft result and keep them loaded until the binding is terminated
+	KeepResident UMETA(DisplayName = "Keep Resident")
+};
+
 /**
  * Map a value to another value of a different type, similar to a Switch statement. Auto-populates for bool and enum inputs.
  */
@@ -12,13 +24,17 @@ class MDFASTBINDING_API UMDFastBindingValue_Select : public UMDFastBindingValueB
 	GENERATED_BODY()
 
 public:
+	virtual void BeginDestroy() override;
 
 	virtual const FProperty* GetOutputProperty() override;
 
 	virtual bool HasUserExtendablePinList() const override;
 
 protected:
+	virtual void InitializeValue_Internal(UObject* SourceObject) override;
 	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+	virtual bool IsBindingItemRelevantToUpdate(int32 ItemIndex) const override;
+	virtual void TerminateValue_Internal(UObject* SourceObject) override;
 	virtual void SetupBindingItems() override;
 	virtual void SetupExtendablePinBindingItem(int32 ItemIndex) override;
 
@@ -29,10 +45,46 @@ protected:
 	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
 #endif
 
+	// When the results are soft object references, load the assets for all results ahead of time so switching between them doesn't hitch
+	UPROPERTY(EditAnywhere, Category = "Performance")
+	EMDFastBindingSelectPrefetchMode PrefetchMode = EMDFastBindingSelectPrefetchMode::None;
+
 private:
 	const FProperty* ResolveOutputProperty();
 
+	TTuple<const FProperty*, void*> GetSelectedValue(UObject* SourceObject, const FName& ItemName);
+
+	// Finds the Select Value pin matching InputValue, returning its binding item index
+	int32 FindMatchingMapping(UObject* SourceObject, const TTuple<const FProperty*, void*>& InputValue);
+
+	void BuildLookup(UObject* SourceObject, const FProperty* InputProp);
+	void FreeLookup();
+	void* GetLookupKey(int32 KeyIndex) const;
+
+	void RequestPrefetch(UObject* SourceObject);
+	void OnPrefetchRequested(TSharedPtr<FStreamableHandle> Handle);
+
 	TWeakFieldPtr<const FProperty> ResolvedOutputProperty;
 
 	TMap<int64, FName> EnumValueToPinNameMap;
+
+	// Select Value pins with default values, converted to the input's type and hashed when first selecting
+	TWeakFieldPtr<const FProperty> LookupKeyProp;
+	uint8* LookupKeyData = nullptr;
+	int32 LookupKeyStride = 0;
+	TArray<int32> LookupKeyItemIndices;
+	TMultiMap<uint32, int32> LookupKeysByHash;
+
+	// Select Value pins that are connected to other nodes (or couldn't be hashed), compared one by one in pin order
+	TArray<int32> LinearItemIndices;
+
+	bool bHasBuiltLookup = false;
+
+	// The result pin that was output last update, only it and the pins that choose the result are tracked for changes
+	int32 SelectedItemIndex = INDEX_NONE;
+
+	TSharedPtr<FStreamableHandle> PrefetchHandle;
+
+	bool bNeedsPrefetch = false;
+	bool bIsAwaitingPrefetch = false;
 };
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "MDFastBindingValueBase.h"
+#include "MDFastBindingValue_Temporal.generated.h"
+
+UENUM()
+enum class EMDFastBindingTemporalMode : uint8
+{
+	// Outputs the input once it has stopped changing for Interval seconds
+	Debounce,
+	// Outputs input changes immediately but at most once every Interval seconds, later changes are output when the interval is up
+	Throttle,
+	// Outputs the latest input every Interval seconds, whether or not it changed
+	Sample
+};
+
+/**
+ * Limits how often a value passes through, based on time.
+ * Between outputs the node is asleep and the binding stops ticking unless something else needs it,
+ * except for Debounce which has to watch its input for changes.
+ */
+UCLASS(meta = (DisplayName = "Temporal"))
+class MDFASTBINDING_API UMDFastBindingValue_Temporal : public UMDFastBindingValueBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual void BeginDestroy() override;
+
+	virtual const FProperty* GetOutputProperty() override;
+
+	virtual bool IsSchedulingBoundary() const override;
+
+#if WITH_EDITORONLY_DATA
+	virtual FText GetDisplayName() override;
+#endif
+
+protected:
+	virtual bool CheckNeedsUpdate() const override;
+
+	virtual void InitializeValue_Internal(UObject* SourceObject) override;
+	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+	virtual void TerminateValue_Internal(UObject* SourceObject) override;
+	virtual void SetupBindingItems() override;
+
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	EMDFastBindingTemporalMode TemporalMode = EMDFastBindingTemporalMode::Throttle;
+
+	// In seconds, for Throttle this is 1 / the max updates per second
+	UPROPERTY(EditAnywhere, Category = "Binding", meta = (ClampMin = "0", Units = "s"))
+	float Interval = 0.25f;
+
+private:
+	const FProperty* ResolveOutputProperty();
+
+	// Copies the input into the value we output, which doesn't change while the input is held back
+	void StoreOutput(const FProperty* InputProp, const void* InputValuePtr);
+	void FreeOutput();
+
+	TWeakFieldPtr<const FProperty> ResolvedOutputProperty;
+
+	TTuple<const FProperty*, void*> OutputValue;
+
+	double LastOutputTime = 0.0;
+	double LastInputChangeTime = 0.0;
+
+	bool bHasPendingInput = false;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "MDFastBindingValueBase.h"
+#include "MDFastBindingValue_Time.generated.h"
+
+UENUM()
+enum class EMDFastBindingTimeMode : uint8
+{
+	// The current time
+	Now,
+	// Seconds since Reference Time, eg. a match's elapsed time
+	TimeSince UMETA(DisplayName = "Time Since"),
+	// Seconds left until Reference Time, stopping at 0, eg. a countdown
+	TimeUntil UMETA(DisplayName = "Time Until")
+};
+
+UENUM()
+enum class EMDFastBindingTimeSource : uint8
+{
+	// Affected by time dilation and pausing
+	WorldTime UMETA(DisplayName = "World Time"),
+	// Real seconds since the world started
+	RealTime UMETA(DisplayName = "Real Time")
+};
+
+/**
+ * Outputs a time rounded to Resolution. Rather than updating every frame, the node works out when its output will next change
+ * and sleeps until then, so a timer showing whole seconds only updates once per second.
+ */
+UCLASS(meta = (DisplayName = "Time"))
+class MDFASTBINDING_API UMDFastBindingValue_Time : public UMDFastBindingValueBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual const FProperty* GetOutputProperty() override;
+
+#if WITH_EDITORONLY_DATA
+	virtual FText GetDisplayName() override;
+#endif
+
+protected:
+	virtual TTuple<const FProperty*, void*> GetValue_Internal(UObject* SourceObject) override;
+	virtual void TerminateValue_Internal(UObject* SourceObject) override;
+	virtual void SetupBindingItems() override;
+
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	EMDFastBindingTimeMode TimeMode = EMDFastBindingTimeMode::TimeSince;
+
+	UPROPERTY(EditAnywhere, Category = "Binding")
+	EMDFastBindingTimeSource TimeSource = EMDFastBindingTimeSource::WorldTime;
+
+	// The output is rounded down to a multiple of this (or up for Time Until), 0 outputs the exact time and updates every frame
+	UPROPERTY(EditAnywhere, Category = "Binding", meta = (ClampMin = "0", Units = "s"))
+	double Resolution = 1.0;
+
+private:
+	// Returns the time until the output changes in the source's seconds, or a negative value if it won't change
+	double UpdateOutput(double CurrentTime);
+
+	void ScheduleNextUpdate(const UWorld* World, double SourceSecondsUntilChange);
+
+	UPROPERTY(Transient)
+	double OutputValue = 0.0;
+
+	UPROPERTY(Transient)
+	double ReferenceTime = 0.0;
+};
@@ -1,8 +1,15 @@
 ﻿#pragma once
 
 #include "UObject/Object.h"
+#include "Runtime/Launch/Resources/Version.h"
+#if ENGINE_MAJOR_VERSION > 5 || ENGINE_MINOR_VERSION >= 3
+#include "FieldNotificationId.h"
+#else
+#include "FieldNotification/FieldId.h"
+#endif
 #include "MDFastBindingContainer.generated.h"
 
+class UMDFastBindingDestinationBase;
 class UMDFastBindingInstance;
 
 /**
@@ -18,6 +25,13 @@ public:
 
 	void UpdateBindings(UObject* SourceObject);
 
+	// Updates a single binding if it's ticking, FinishUpdatingBindings must be called once all of the bindings have been updated.
+	// Used to update the same binding across many containers in a row.
+	void UpdateBinding(UObject* SourceObject, int32 BindingIndex);
+	void FinishUpdatingBindings();
+
+	int32 GetNumBindings() const { return Bindings.Num(); }
+
 	void TerminateBindings(UObject* SourceObject);
 
 	void SetBindingTickPolicy(UMDFastBindingInstance* Binding, bool bShouldTick);
@@ -28,6 +42,12 @@ public:
 
 	UClass* GetBindingOwnerClass() const;
 
+	// When true, destinations stage their writes during UpdateBindings and the container commits them grouped by target object
+	bool IsDeferringDestinationWrites() const { return bIsDeferringDestinationWrites; }
+
+	void QueueDestinationCommit(UMDFastBindingDestinationBase* Destination, UObject* TargetObject);
+	void QueueFieldValueChangedBroadcast(UObject* TargetObject, const UE::FieldNotification::FFieldId& FieldId);
+
 	UE_DEPRECATED(all, "GetBindingOwnerClassDelegate is deprecated, the binding's outer object should implement IMDFastBindingOwnerInterface instead")
 	FSimpleDelegate GetBindingOwnerClassDelegate;
 
@@ -44,6 +64,9 @@ public:
 
 #if WITH_EDITOR
 	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
+
+	// Swaps in faster equivalents of binding objects where possible, only called on compiled copies of the bindings
+	void OptimizeForRuntime();
 #endif
 
 protected:
@@ -55,4 +78,23 @@ protected:
 
 private:
 	void UpdateNeedsTick();
+
+	void CommitDestinations();
+
+	struct FPendingDestinationCommit
+	{
+		UObject* TargetObject = nullptr;
+		UMDFastBindingDestinationBase* Destination = nullptr;
+	};
+
+	struct FPendingFieldValueChanged
+	{
+		UObject* TargetObject = nullptr;
+		UE::FieldNotification::FFieldId FieldId;
+	};
+
+	bool bIsDeferringDestinationWrites = false;
+
+	TArray<FPendingDestinationCommit> PendingCommits;
+	TArray<FPendingFieldValueChanged> PendingFieldValueChanges;
 };
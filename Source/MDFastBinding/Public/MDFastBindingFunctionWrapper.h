@@ -56,6 +56,9 @@ public:
 	// Last chance to opt-out of calling the function (ie, if none of the params updated)
 	FMDShouldCallFunction ShouldCallFunction;
 
+	// If true, a shadow copy of the params is kept and the function isn't called when the owner and params are identical to the last call
+	bool bSkipCallIfParamsUnchanged = false;
+
 	UPROPERTY(meta = (DeprecatedProperty))
 	FName FunctionName = NAME_None;
 
@@ -83,6 +86,16 @@ private:
 	void InitFunctionMemory();
 	void PopulateParams(UObject* SourceObject);
 
+	// Shadow copy of the params used in the last call, only used with bSkipCallIfParamsUnchanged
+	void* LastCallParamMemory = nullptr;
+	TArray<const FProperty*> LastCallParams;
+	TWeakObjectPtr<UFunction> LastCallFunction;
+	TWeakObjectPtr<UObject> LastCallOwner;
+	bool bHasLastCallParams = false;
+	bool AreParamsIdenticalToLastCall(const UObject* FunctionOwner) const;
+	void StoreLastCallParams(UObject* FunctionOwner);
+	void FreeLastCallParamMemory();
+
 	void FixupFunctionMember();
 	void RefreshCachedProperties();
 };
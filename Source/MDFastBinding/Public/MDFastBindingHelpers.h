@@ -6,6 +6,7 @@
 #include "MDFastBindingHelpers.generated.h"
 
 class FProperty;
+struct FStreamableManager;
 class UFunction;
 class UWidgetBlueprintGeneratedClass;
 
@@ -20,6 +21,9 @@ public:
 	static bool ArePropertyValuesEqual(const FProperty* PropA, const void* ValuePtrA, const FProperty* PropB, const void* ValuePtrB);
 
 	static bool DoesClassHaveSuperClassBindings(UWidgetBlueprintGeneratedClass* Class);
+
+	// The asset manager's streamable manager if there is one, otherwise a shared fallback
+	static FStreamableManager& GetStreamableManager();
 };
 
 UCLASS(Hidden, MinimalAPI)
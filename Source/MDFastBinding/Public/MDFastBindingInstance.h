@@ -42,6 +42,9 @@ public:
 
 	int32 GetBindingIndex() const;
 	void MoveToIndex(int32 Index);
+
+	// Swaps in faster equivalents of binding objects where possible, only called on compiled copies of the bindings
+	void OptimizeForRuntime();
 #endif
 
 #if WITH_EDITORONLY_DATA
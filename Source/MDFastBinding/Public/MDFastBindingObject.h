@@ -22,7 +22,9 @@ enum class EMDFastBindingUpdateType
 	// User's cannot select EventBased, it is determined by the nature of the binding object (eg. FieldNotify properties)
 	EventBased UMETA(Hidden),
 	// Will grab the latest value until it's successful, then reuses that value in future updates
-	Once
+	Once,
+	// Will grab the latest value every UpdateInterval seconds, the binding doesn't tick in between
+	Interval
 };
 
 // Represented as a pin in the binding editor graph
@@ -131,8 +133,18 @@ public:
 
 	void RemoveExtendablePinBindingItem(int32 ItemIndex);
 
+	// Forces this object to update next time it's checked, regardless of its update type
 	void MarkObjectDirty();
+	// Called after updating, schedules the next update of Interval objects
 	void MarkObjectClean();
+	bool IsObjectDirty() const { return bIsObjectDirty; }
+
+	// Objects that decide for themselves when to next update (eg. by scheduling a wake-up) return true so that
+	// frequently updating binding items below them don't make the binding tick every frame
+	virtual bool IsSchedulingBoundary() const { return false; }
+
+	// The update type this object behaves as, objects that know exactly when their output changes can treat Always as IfUpdatesNeeded
+	virtual EMDFastBindingUpdateType GetEffectiveUpdateType() const { return UpdateType; }
 
 	// Wrapper around CheckNeedsUpdate with a TFrameValue cache so that multiple calls in a frame are "free"
 	bool CheckCachedNeedsUpdate() const;
@@ -191,6 +203,9 @@ private:
 public:
 	virtual EDataValidationResult IsDataValid(TArray<FText>& ValidationErrors) override;
 
+	// Whether a value of ValueProp can be connected to BindingItem, objects that convert their inputs themselves can accept more than FMDFastBindingModule::CanSetProperty does
+	virtual bool CanBindingItemAcceptValue(const FMDFastBindingItem& BindingItem, const FProperty* ValueProp) const;
+
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 
 	virtual TSharedRef<class SWidget> CreateNodeHeaderWidget();
@@ -207,6 +222,13 @@ protected:
 
 	virtual bool CheckNeedsUpdate() const;
 
+	// Whether any of the values or default values of our binding items need to be updated
+	bool CheckBindingItemsNeedUpdate() const;
+
+	// Short-circuiting objects (eg. Select) can return false for items that their current output doesn't depend on,
+	// so changes to them don't cause an update
+	virtual bool IsBindingItemRelevantToUpdate(int32 ItemIndex) const { return true; }
+
 	virtual void SetupBindingItems() {}
 
 	virtual void SetupExtendablePinBindingItem(int32 ItemIndex) {}
@@ -229,6 +251,10 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Performance")
 	EMDFastBindingUpdateType UpdateType = EMDFastBindingUpdateType::IfUpdatesNeeded;
 
+	// Seconds between updates when using the Interval update type
+	UPROPERTY(EditAnywhere, Category = "Performance", meta = (ClampMin = "0", Units = "s", EditCondition = "UpdateType == EMDFastBindingUpdateType::Interval", EditConditionHides))
+	float UpdateInterval = 0.25f;
+
 private:
 	UPROPERTY(Transient)
 	bool bIsObjectDirty = false;
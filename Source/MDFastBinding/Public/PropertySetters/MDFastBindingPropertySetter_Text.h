@@ -0,0 +1,25 @@
+#pragma once
+
+#include "IMDFastBindingPropertySetter.h"
+
+class FNumericProperty;
+class FText;
+
+/**
+ * Converts numbers, strings and names to FText.
+ * Format Text uses this for its arguments. It isn't registered by default, since it would let these types connect to every text pin,
+ * projects that want that can register it with FMDFastBindingModule::AddPropertySetter.
+ */
+class MDFASTBINDING_API FMDFastBindingPropertySetter_Text : public IMDFastBindingPropertySetter
+{
+public:
+	virtual void SetPropertyInContainer(const FProperty& DestinationProp, void* DestinationContainerPtr, const FProperty& SourceProp, const void* SourceValuePtr) const override;
+	virtual void SetPropertyDirectly(const FProperty& DestinationProp, void* DestinationValuePtr, const FProperty& SourceProp, const void* SourceValuePtr) const override;
+	virtual bool CanSetProperty(const FProperty& DestinationProp, const FProperty& SourceProp) const override;
+
+	// Formats the number as text in the current culture, the same as FText::AsNumber, using the shared number text cache
+	static FText NumericToText(const FNumericProperty& NumericProp, const void* ValuePtr);
+
+	static bool CanConvertToText(const FProperty& SourceProp);
+	static FText ToText(const FProperty& SourceProp, const void* SourceValuePtr);
+};
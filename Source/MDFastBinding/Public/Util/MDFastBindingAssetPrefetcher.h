@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "Delegates/Delegate.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/WeakObjectPtr.h"
+
+struct FStreamableHandle;
+
+DECLARE_DELEGATE_OneParam(FMDFastBindingOnPrefetchRequested, TSharedPtr<FStreamableHandle>);
+
+/**
+ * Queues soft asset loads that bindings want ahead of time.
+ * Requests with the same batch owner (eg. a binding container) are combined into a single streamable request,
+ * and the number of requests issued per frame is limited by the Fast Binding project settings.
+ */
+class MDFASTBINDING_API FMDFastBindingAssetPrefetcher
+{
+public:
+	static FMDFastBindingAssetPrefetcher& Get();
+
+	// OnRequested is called with the batch's handle once the load has been issued, the handle is null if there was nothing to load
+	void RequestPrefetch(const UObject* BatchOwner, const TArray<FSoftObjectPath>& Paths, FMDFastBindingOnPrefetchRequested&& OnRequested);
+
+	void Shutdown();
+
+private:
+	struct FPrefetchBatch
+	{
+		TWeakObjectPtr<const UObject> Owner;
+		TArray<FSoftObjectPath> Paths;
+		TArray<FMDFastBindingOnPrefetchRequested> Callbacks;
+	};
+
+	bool Tick(float DeltaTime);
+
+	void IssueBatch(FPrefetchBatch& Batch);
+
+	TArray<FPrefetchBatch> PendingBatches;
+
+	FTSTicker::FDelegateHandle TickHandle;
+};
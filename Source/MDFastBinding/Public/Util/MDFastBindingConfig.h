@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Engine/DeveloperSettings.h"
+#include "MDFastBindingConfig.generated.h"
+
+UCLASS(config = "FastBinding", defaultconfig, meta = (DisplayName = "Fast Binding"))
+class MDFASTBINDING_API UMDFastBindingConfig : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UMDFastBindingConfig();
+
+	bool ShouldDeferDestinationWrites() const { return bDeferDestinationWrites; }
+
+	bool ShouldBatchWidgetUpdates() const { return bBatchWidgetUpdates; }
+
+	int32 GetMaxPrefetchBatchesPerFrame() const { return MaxPrefetchBatchesPerFrame; }
+
+	int32 GetNumberTextCacheSize() const { return NumberTextCacheSize; }
+
+protected:
+	// If true, binding containers first evaluate all of their bindings into staged values, then commit the destination writes grouped by target object.
+	// FieldNotify broadcasts from property destinations are also deferred and sent once per target and field.
+	UPROPERTY(EditDefaultsOnly, Config, Category = "Performance")
+	bool bDeferDestinationWrites = false;
+
+	// If true, widget bindings are updated once per frame by a shared updater instead of each widget's tick.
+	// Instances of the same widget class are updated together, one binding at a time across all instances, which suits large numbers of identical widgets (list entries, nameplates).
+	// Bindings are updated even when their widget isn't painted.
+	UPROPERTY(EditDefaultsOnly, Config, Category = "Performance")
+	bool bBatchWidgetUpdates = false;
+
+	// The maximum number of asset prefetch requests issued per frame across all bindings, each request covers the assets of one binding container
+	UPROPERTY(EditDefaultsOnly, Config, Category = "Performance", meta = (ClampMin = "1"))
+	int32 MaxPrefetchBatchesPerFrame = 4;
+
+	// How many integer and how many floating point numbers to keep formatted as text when bindings convert numbers to text, 0 disables the cache.
+	// Takes effect on next launch.
+	UPROPERTY(EditDefaultsOnly, Config, Category = "Performance", meta = (ClampMin = "0"))
+	int32 NumberTextCacheSize = 1024;
+};
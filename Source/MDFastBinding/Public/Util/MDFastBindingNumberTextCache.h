@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Containers/LruCache.h"
+#include "Internationalization/Text.h"
+
+/**
+ * Bounded cache of numbers formatted as text in the current culture, bindings tend to display the same handful of values over and over.
+ * Flushed whenever the culture changes. Only used from the game thread, other threads format directly.
+ */
+class MDFASTBINDING_API FMDFastBindingNumberTextCache
+{
+public:
+	static FMDFastBindingNumberTextCache& Get();
+
+	FText AsNumber(int64 Value);
+	FText AsNumber(double Value);
+
+	void Empty();
+
+	void Shutdown();
+
+private:
+	bool IsEnabled();
+
+	void OnCultureChanged();
+
+	TLruCache<int64, FText> IntegerCache;
+	TLruCache<double, FText> FloatCache;
+
+	FDelegateHandle CultureChangedHandle;
+
+	bool bIsInitialized = false;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UMDFastBindingObject;
+
+/**
+ * Wakes binding objects up at a requested time by marking them dirty, so bindings that only change on a timer don't need to tick in between.
+ * Wake-ups are kept in a min-heap and each object has at most one pending wake-up, scheduling again replaces it.
+ */
+class MDFASTBINDING_API FMDFastBindingScheduler
+{
+public:
+	static FMDFastBindingScheduler& Get();
+
+	// The clock wake times are measured against, this is the app time so it's consistent for the whole frame
+	static double GetCurrentTime();
+
+	void ScheduleWakeUp(UMDFastBindingObject* Object, double WakeTime);
+	void CancelWakeUp(const UMDFastBindingObject* Object);
+
+	bool IsWakeUpScheduled(const UMDFastBindingObject* Object) const;
+
+	void Shutdown();
+
+private:
+	struct FScheduledWakeUp
+	{
+		double WakeTime = 0.0;
+		TWeakObjectPtr<UMDFastBindingObject> Object;
+		TObjectKey<UMDFastBindingObject> ObjectKey;
+
+		bool operator<(const FScheduledWakeUp& Other) const
+		{
+			return WakeTime < Other.WakeTime;
+		}
+	};
+
+	bool Tick(float DeltaTime);
+
+	TArray<FScheduledWakeUp> WakeUpHeap;
+
+	// Rescheduled and cancelled wake-ups are left in the heap and skipped when they no longer match this
+	TMap<TObjectKey<UMDFastBindingObject>, double> WakeTimes;
+
+	FTSTicker::FDelegateHandle TickHandle;
+};
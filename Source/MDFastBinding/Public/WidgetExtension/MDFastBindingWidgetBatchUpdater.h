@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "UObject/WeakObjectPtr.h"
+
+class UClass;
+class UMDFastBindingWidgetExtension;
+
+/**
+ * Updates the bindings of widget extensions once per frame instead of from each widget's tick.
+ * Extensions are grouped by widget class and updated binding by binding across all instances of that class,
+ * so each binding's nodes run back to back rather than interleaved with every other binding of every widget.
+ */
+class MDFASTBINDING_API FMDFastBindingWidgetBatchUpdater
+{
+public:
+	static FMDFastBindingWidgetBatchUpdater& Get();
+
+	void RegisterExtension(UMDFastBindingWidgetExtension* Extension);
+	void UnregisterExtension(UMDFastBindingWidgetExtension* Extension);
+
+	void Shutdown();
+
+private:
+	bool Tick(float DeltaTime);
+
+	void AddPendingRegistrations();
+	void UpdateBatch(TArray<TWeakObjectPtr<UMDFastBindingWidgetExtension>>& Extensions);
+
+	TMap<TWeakObjectPtr<UClass>, TArray<TWeakObjectPtr<UMDFastBindingWidgetExtension>>> ExtensionsByClass;
+
+	// Widgets can be created while a batch is updating, so registrations are added to ExtensionsByClass at the start of the next tick
+	TArray<TWeakObjectPtr<UMDFastBindingWidgetExtension>> PendingRegistrations;
+
+	FTSTicker::FDelegateHandle TickHandle;
+};
@@ -15,6 +15,7 @@ class MDFASTBINDING_API UMDFastBindingWidgetExtension : public UUserWidgetExtens
 	GENERATED_BODY()
 
 	friend class UMDFastBindingWidgetClassExtension;
+	friend class FMDFastBindingWidgetBatchUpdater;
 
 public:
 	virtual void Construct() override;
@@ -42,6 +43,14 @@ protected:
 	void AddSuperBindingContainer(const UMDFastBindingContainer* SuperCDOBindingContainer);
 
 private:
+	int32 GetNumContainers() const { return SuperBindingContainers.Num() + 1; }
+	// Index 0 is BindingContainer, SuperBindingContainers starts from Index 1
+	UMDFastBindingContainer* GetContainerAtIndex(int32 Index) const;
+
+	// Called by the batch updater after it has updated each binding of our ticking containers
+	void FinishBatchUpdate();
+	void UpdateBatchRegistration();
+
 	UPROPERTY(Instanced)
 	TObjectPtr<UMDFastBindingContainer> BindingContainer = nullptr;
 
@@ -50,4 +59,8 @@ private:
 
 	// Index 0 is BindingContainer, SuperBindingContainers starts from Index 1
 	TBitArray<> TickingContainers;
+
+	// If true, our bindings are updated by FMDFastBindingWidgetBatchUpdater rather than our tick
+	bool bIsBatchUpdating = false;
+	bool bIsRegisteredForBatchUpdate = false;
 };
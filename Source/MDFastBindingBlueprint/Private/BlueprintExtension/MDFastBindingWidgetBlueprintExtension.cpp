@@ -62,7 +62,7 @@ void UMDFastBindingWidgetBlueprintExtension::HandleCopyTermDefaultsToDefaultObje
 				BindingClass->SetBindingContainer(BindingContainer);
 			}
 		
-			// There's a chance we could perform some compile-time steps here that would improve runtime performance
+			// The class extension's copy of the bindings has compile-time optimizations applied (see UMDFastBindingContainer::OptimizeForRuntime)
 			CompilerContext->AddExtension(WidgetBPClass, BindingClass);
 
 			// The blueprint has been fully recompiled here, we need to update the binding graphs
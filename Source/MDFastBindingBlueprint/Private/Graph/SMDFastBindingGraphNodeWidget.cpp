@@ -173,6 +173,9 @@ void SMDFastBindingGraphNodeWidget::GetOverlayBrushes(bool bSelected, const FVec
 			case EMDFastBindingUpdateType::Always:
 				UpdateTypeBrush.Brush = FastBindingStyle->GetBrush(TEXT("Icon.UpdateType.Always"));
 				break;
+			case EMDFastBindingUpdateType::Interval:
+				UpdateTypeBrush.Brush = FastBindingStyle->GetBrush(TEXT("Icon.UpdateType.Interval"));
+				break;
 			}
 		}
 
@@ -58,6 +58,7 @@ TSharedRef<FSlateStyleSet> FMDFastBindingEditorStyle::Create()
 	Style->Set(TEXT("Icon.UpdateType.EventBased"), new IMAGE_BRUSH(TEXT("UpdateTypeEventBasedIcon_32x"), Icon32x32));
 	Style->Set(TEXT("Icon.UpdateType.IfUpdatesNeeded"), new IMAGE_BRUSH(TEXT("UpdateTypeIfUpdatesNeededIcon_32x"), Icon32x32));
 	Style->Set(TEXT("Icon.UpdateType.Always"), new IMAGE_BRUSH(TEXT("UpdateTypeAlwaysIcon_32x"), Icon32x32));
+	Style->Set(TEXT("Icon.UpdateType.Interval"), new IMAGE_BRUSH(TEXT("ClockIcon_16x"), Icon16x16));
 
 	Style->Set(TEXT("Background.Selector"), new FSlateColorBrush(FStyleColors::Select.GetSpecifiedColor() * 0.5f));
 	Style->Set(TEXT("Background.SelectorInactive"), new FSlateColorBrush(FLinearColor::Transparent));